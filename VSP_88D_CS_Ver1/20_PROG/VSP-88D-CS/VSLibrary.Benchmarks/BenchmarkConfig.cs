@@ -0,0 +1,57 @@
+﻿using System.Diagnostics;
+using BenchmarkDotNet.Columns;
+using BenchmarkDotNet.Configs;
+using BenchmarkDotNet.Diagnosers;
+using BenchmarkDotNet.Exporters.Json;
+
+namespace VSLibrary.Benchmarks;
+
+/// <summary>
+/// 커밋 간 결과 비교를 위한 공통 설정.
+/// 결과는 BenchmarkDotNet.Artifacts/{revision} 아래에 JSON(full) + GitHub Markdown으로 남습니다.
+/// revision은 BENCHMARK_REVISION 환경변수 → git 짧은 해시 → "local" 순으로 결정합니다.
+/// </summary>
+public static class BenchmarkConfig
+{
+    private const string RevisionVariable = "BENCHMARK_REVISION";
+
+    public static IConfig Create()
+    {
+        return ManualConfig.Create(DefaultConfig.Instance)
+            .WithArtifactsPath(Path.Combine("BenchmarkDotNet.Artifacts", GetRevision()))
+            .AddExporter(JsonExporter.Full)
+            .AddDiagnoser(MemoryDiagnoser.Default)
+            .AddColumn(StatisticColumn.P95);
+    }
+
+    private static string GetRevision()
+    {
+        var revision = Environment.GetEnvironmentVariable(RevisionVariable);
+        if (!string.IsNullOrWhiteSpace(revision))
+            return revision.Trim();
+
+        try
+        {
+            using var git = Process.Start(new ProcessStartInfo("git", "rev-parse --short HEAD")
+            {
+                RedirectStandardOutput = true,
+                RedirectStandardError = true,
+                UseShellExecute = false,
+                CreateNoWindow = true
+            });
+            if (git != null)
+            {
+                var output = git.StandardOutput.ReadToEnd().Trim();
+                git.WaitForExit();
+                if (git.ExitCode == 0 && output.Length > 0)
+                    return output;
+            }
+        }
+        catch (Exception)
+        {
+            // git이 없는 환경
+        }
+
+        return "local";
+    }
+}
@@ -0,0 +1,127 @@
+﻿using System.Text;
+using BenchmarkDotNet.Attributes;
+using BenchmarkDotNet.Configs;
+using VSLibrary.Communication.Packet.Checksum;
+
+namespace VSLibrary.Benchmarks;
+
+/// <summary>
+/// PacketChecksum 커널과 기존 구현 비교.
+/// 알고리즘별 카테고리마다 기존 구현(또는 BCL)을 Baseline으로 두어 Ratio가 카테고리 안에서 계산됩니다.
+/// </summary>
+[GroupBenchmarksBy(BenchmarkLogicalGroupRule.ByCategory)]
+[CategoriesColumn]
+public class ChecksumBenchmarks
+{
+    private static readonly uint[] LegacyCrc32Table = BuildLegacyCrc32Table();
+
+    private byte[] _frame = null!;
+    private byte[] _hex = null!;
+    private byte[] _hexBuffer = null!;
+    private byte[] _rawBuffer = null!;
+
+    [Params(8, 64, 256, 1024)]
+    public int Size;
+
+    [GlobalSetup]
+    public void Setup()
+    {
+        _frame = new byte[Size];
+        new Random(42).NextBytes(_frame);
+
+        _hexBuffer = new byte[Size * 2];
+        PacketChecksum.TryEncodeHex(_frame, _hexBuffer, out _);
+        _hex = _hexBuffer.ToArray();
+        _rawBuffer = new byte[Size];
+    }
+
+    [Benchmark(Baseline = true), BenchmarkCategory("Crc16")]
+    public ushort Crc16_Legacy() => LegacyCrc16(_frame);
+
+    [Benchmark, BenchmarkCategory("Crc16")]
+    public ushort Crc16() => PacketChecksum.ComputeCrc16(_frame);
+
+    [Benchmark(Baseline = true), BenchmarkCategory("Crc32")]
+    public uint Crc32_Legacy() => LegacyCrc32(_frame);
+
+    // 하드웨어 경로(ARM64 CRC32 / x64 PCLMULQDQ)와 분리해서 본 Slicing-by-8 테이블 경로
+    [Benchmark, BenchmarkCategory("Crc32")]
+    public uint Crc32_Table() => ~PacketChecksum.UpdateCrc32Table(PacketChecksum.Crc32Seed, _frame);
+
+    [Benchmark, BenchmarkCategory("Crc32")]
+    public uint Crc32() => PacketChecksum.ComputeCrc32(_frame);
+
+    [Benchmark(Baseline = true), BenchmarkCategory("Lrc")]
+    public byte Lrc_Legacy() => LegacyLrc(_frame);
+
+    [Benchmark, BenchmarkCategory("Lrc")]
+    public byte Lrc() => PacketChecksum.ComputeLrc(_frame);
+
+    // 기준: BCL 벡터화 구현 (문자열 생성 포함)
+    [Benchmark(Baseline = true), BenchmarkCategory("HexEncode")]
+    public string HexEncode_Bcl() => Convert.ToHexString(_frame);
+
+    [Benchmark, BenchmarkCategory("HexEncode")]
+    public int HexEncode()
+    {
+        PacketChecksum.TryEncodeHex(_frame, _hexBuffer, out int written);
+        return written;
+    }
+
+    // 기준: BCL 벡터화 구현 (ASCII → string 변환 포함)
+    [Benchmark(Baseline = true), BenchmarkCategory("HexDecode")]
+    public byte[] HexDecode_Bcl() => Convert.FromHexString(Encoding.ASCII.GetString(_hex));
+
+    [Benchmark, BenchmarkCategory("HexDecode")]
+    public int HexDecode()
+    {
+        PacketChecksum.TryDecodeHex(_hex, _rawBuffer, out int written);
+        return written;
+    }
+
+    #region 기존 구현 (비교 기준)
+
+    private static ushort LegacyCrc16(byte[] data)
+    {
+        ushort crc = 0xFFFF;
+        for (int i = 0; i < data.Length; i++)
+        {
+            crc ^= data[i];
+            for (int j = 0; j < 8; j++)
+                crc = (ushort)((crc & 1) != 0 ? (crc >> 1) ^ 0xA001 : crc >> 1);
+        }
+        return crc;
+    }
+
+    private static uint LegacyCrc32(byte[] data)
+    {
+        uint crc = 0xFFFFFFFF;
+        for (int i = 0; i < data.Length; i++)
+            crc = (crc >> 8) ^ LegacyCrc32Table[(crc ^ data[i]) & 0xFF];
+        return crc ^ 0xFFFFFFFF;
+    }
+
+    private static byte LegacyLrc(byte[] data)
+    {
+        byte sum = 0;
+        for (int i = 0; i < data.Length; i++)
+            unchecked { sum += data[i]; }
+        return (byte)((sum ^ 0xFF) + 1);
+    }
+
+    private static uint[] BuildLegacyCrc32Table()
+    {
+        const uint polynomial = 0xEDB88320;
+        var table = new uint[256];
+        for (uint i = 0; i < 256; i++)
+        {
+            uint crc = i;
+            for (int j = 0; j < 8; j++)
+                crc = (crc & 1) != 0 ? (crc >> 1) ^ polynomial : crc >> 1;
+            table[i] = crc;
+        }
+        return table;
+    }
+
+    #endregion
+}
@@ -0,0 +1,75 @@
+﻿using System.Text;
+using BenchmarkDotNet.Attributes;
+using VSLibrary.Communication;
+using VSLibrary.Communication.Loopback;
+using VSLibrary.Communication.Packet.Modbus;
+using VSLibrary.Communication.Packet.Protocol.Test;
+
+namespace VSLibrary.Benchmarks;
+
+/// <summary>
+/// CommunicationBase 수신 프레임 분리(ProcessReceivedBytes)와 요청-응답(SendReceiveAsync) 경로.
+/// 포트/네트워크 없이 루프백 채널과 가상 Modbus 슬레이브를 사용합니다.
+/// </summary>
+public class CommunicationBenchmarks
+{
+    /// <summary>
+    /// 수신 바이트를 직접 밀어넣기 위한 루프백 채널
+    /// </summary>
+    private sealed class FeedLoopback : LoopbackBase
+    {
+        public FeedLoopback(ICommunicationConfig config) : base(config)
+        {
+            _startSeq = null;
+            _delimiter = Encoding.ASCII.GetBytes("\r\n");
+        }
+
+        public void Feed(byte[] chunk) => ProcessReceivedBytes(chunk);
+    }
+
+    private FeedLoopback _feed = null!;
+    private TestLoopback _echo = null!;
+    private ModbusSimulator _modbus = null!;
+    private byte[] _chunk = null!;
+
+    /// <summary>한 번에 수신되는 프레임 수</summary>
+    [Params(1, 16)]
+    public int FramesPerChunk;
+
+    [GlobalSetup]
+    public void Setup()
+    {
+        _feed = new FeedLoopback(new LoopbackConfig("Feed", CommunicationTarget.TestLoopback));
+        _echo = new TestLoopback(new LoopbackConfig("Echo", CommunicationTarget.TestLoopback));
+        _modbus = new ModbusSimulator(new LoopbackConfig("Modbus", CommunicationTarget.TestModbusSimulator));
+
+        _feed.OpenAsync().GetAwaiter().GetResult();
+        _echo.OpenAsync().GetAwaiter().GetResult();
+        _modbus.OpenAsync().GetAwaiter().GetResult();
+
+        for (int i = 0; i < 16; i++)
+            _modbus.Slave.HoldingRegisters[i] = (ushort)(i * 100);
+
+        var frames = new StringBuilder();
+        for (int i = 0; i < FramesPerChunk; i++)
+            frames.Append($"TMP{i:D2}.5C,VLT{i:D3}V,PWRON\r\n");
+        _chunk = Encoding.ASCII.GetBytes(frames.ToString());
+    }
+
+    [GlobalCleanup]
+    public void Cleanup()
+    {
+        _feed.CloseAsync().GetAwaiter().GetResult();
+        _echo.CloseAsync().GetAwaiter().GetResult();
+        _modbus.CloseAsync().GetAwaiter().GetResult();
+    }
+
+    [Benchmark]
+    public void ProcessReceivedBytes() => _feed.Feed(_chunk);
+
+    [Benchmark]
+    public Task<string?> SendReceive_Echo() => _echo.EchoAsync("PWR?", 1000);
+
+    [Benchmark]
+    public Task<ushort[]> SendReceive_ModbusReadHolding16() => _modbus.ReadHoldingRegistersAsync(0, 16);
+}
@@ -0,0 +1,47 @@
+﻿using BenchmarkDotNet.Attributes;
+using VSLibrary.Common.MVVM.Core;
+using VSLibrary.Controller;
+using VSLibrary.Threading;
+
+namespace VSLibrary.Benchmarks;
+
+/// <summary>
+/// ControllerManager.UpdateControllerData 한 주기 비용 (시뮬레이션 AIO/DIO/Motion).
+/// LatencyMs로 보드 드라이버 호출 지연을 흉내낼 수 있습니다.
+/// </summary>
+public class ControllerBenchmarks
+{
+    // ControllerManager 생성자가 띄우는 갱신 스레드 이름
+    private const string UpdateThreadName = "SampleThread";
+
+    private ControllerManager _manager = null!;
+
+    [Params(0.0, 0.05)]
+    public double LatencyMs;
+
+    [GlobalSetup]
+    public void Setup()
+    {
+        ThreadManager.SetContainer(VSContainer.Instance);
+
+        var config = new SimulatedControllerConfig
+        {
+            AnalogInputCount = 16,
+            AnalogOutputCount = 16,
+            DigitalInputCount = 128,
+            DigitalOutputCount = 128,
+            AxisCount = 8,
+            LatencyMs = LatencyMs
+        };
+
+        _manager = new ControllerManager(VSContainer.Instance,
+            new List<ControllerType> { ControllerType.AIO_Simulated, ControllerType.DIO_Simulated, ControllerType.Motion_Simulated },
+            config);
+
+        // 측정 중 경쟁하지 않도록 자체 갱신 스레드는 종료
+        ThreadManager.GetThread(UpdateThreadName)?.Stop();
+    }
+
+    [Benchmark]
+    public void UpdateControllerData() => _manager.UpdateControllerData();
+}
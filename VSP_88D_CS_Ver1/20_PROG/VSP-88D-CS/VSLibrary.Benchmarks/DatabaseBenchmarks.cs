@@ -0,0 +1,65 @@
+﻿using BenchmarkDotNet.Attributes;
+using VSLibrary.Database;
+
+namespace VSLibrary.Benchmarks;
+
+/// <summary>
+/// SQLite 조회 결과를 모델 객체로 변환(materialization)하는 비용 (임시 DB 파일).
+/// </summary>
+public class DatabaseBenchmarks
+{
+    /// <summary>
+    /// 벤치마크용 테이블 모델
+    /// </summary>
+    public class BenchRecord
+    {
+        [PrimaryKey, AutoIncrement]
+        public int Id { get; set; }
+        public string Name { get; set; } = string.Empty;
+        public double Value { get; set; }
+        public long Count { get; set; }
+        public DateTime Timestamp { get; set; }
+    }
+
+    private string _path = null!;
+    private DBManager _db = null!;
+
+    [Params(100, 1000)]
+    public int RowCount;
+
+    [GlobalSetup]
+    public void Setup()
+    {
+        _path = Path.Combine(Path.GetTempPath(), $"VSLibrary.Benchmarks.{Guid.NewGuid():N}.db");
+        _db = new DBManager(DatabaseProvider.SQLite, $"Data Source={_path}");
+
+        var repository = new DynamicRepository<BenchRecord>(_db);
+        repository.EnsureTableAsync().GetAwaiter().GetResult();
+
+        _db.BeginTransaction();
+        for (int i = 0; i < RowCount; i++)
+        {
+            _db.InsertAsync(new BenchRecord
+            {
+                Name = $"Record{i}",
+                Value = i * 0.5,
+                Count = i,
+                Timestamp = new DateTime(2024, 1, 1).AddSeconds(i)
+            }).GetAwaiter().GetResult();
+        }
+        _db.CommitTransaction();
+    }
+
+    [GlobalCleanup]
+    public void Cleanup()
+    {
+        _db.Dispose();
+        try { File.Delete(_path); } catch { }
+    }
+
+    [Benchmark]
+    public Task<IEnumerable<BenchRecord>> SelectAll() => _db.SelectAllAsync<BenchRecord>();
+
+    [Benchmark]
+    public Task<IEnumerable<BenchRecord>> Query() => _db.QueryAsync<BenchRecord>("SELECT * FROM BenchRecord WHERE Count >= 0");
+}
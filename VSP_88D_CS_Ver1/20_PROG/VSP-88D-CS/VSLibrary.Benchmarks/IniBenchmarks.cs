@@ -0,0 +1,56 @@
+﻿using System.Text;
+using BenchmarkDotNet.Attributes;
+using VSLibrary.Common.Ini;
+
+namespace VSLibrary.Benchmarks;
+
+/// <summary>
+/// VsIniManager Get/Set (임시 INI 파일). Set은 줄 목록을 선형 탐색하므로 마지막 키 기준으로 측정합니다.
+/// </summary>
+public class IniBenchmarks
+{
+    private const int SectionCount = 10;
+
+    private string _path = null!;
+    private string _lastSection = null!;
+    private string _lastKey = null!;
+
+    /// <summary>섹션당 키 개수</summary>
+    [Params(20, 200)]
+    public int KeysPerSection;
+
+    [GlobalSetup]
+    public void Setup()
+    {
+        _path = Path.Combine(Path.GetTempPath(), $"VSLibrary.Benchmarks.{Guid.NewGuid():N}.ini");
+
+        var sb = new StringBuilder();
+        for (int s = 0; s < SectionCount; s++)
+        {
+            sb.AppendLine($"[Section{s}]");
+            for (int k = 0; k < KeysPerSection; k++)
+                sb.AppendLine($"Key{k}={s * 1000 + k}");
+            sb.AppendLine();
+        }
+        File.WriteAllText(_path, sb.ToString());
+
+        VsIniManager.Initialize(_path);
+        _lastSection = $"Section{SectionCount - 1}";
+        _lastKey = $"Key{KeysPerSection - 1}";
+    }
+
+    [GlobalCleanup]
+    public void Cleanup()
+    {
+        try { File.Delete(_path); } catch { }
+    }
+
+    [Benchmark]
+    public string? Get() => VsIniManager.Get(_lastSection, _lastKey);
+
+    [Benchmark]
+    public void Set() => VsIniManager.Set(_lastSection, _lastKey, "12345");
+
+    [Benchmark]
+    public void Load() => VsIniManager.Load(_path);
+}
@@ -0,0 +1,29 @@
+﻿using BenchmarkDotNet.Attributes;
+using VSLibrary.Common.Log;
+
+namespace VSLibrary.Benchmarks;
+
+/// <summary>
+/// LogManager.Write 호출 비용 (임시 폴더에 기록).
+/// </summary>
+public class LogBenchmarks
+{
+    private string _logDir = null!;
+
+    [GlobalSetup]
+    public void Setup()
+    {
+        _logDir = Path.Combine(Path.GetTempPath(), $"VSLibrary.Benchmarks.Log.{Guid.NewGuid():N}");
+        Directory.CreateDirectory(_logDir);
+        LogManager.Initialize("Bench.txt", _logDir);
+    }
+
+    [GlobalCleanup]
+    public void Cleanup()
+    {
+        try { Directory.Delete(_logDir, true); } catch { }
+    }
+
+    [Benchmark]
+    public void Write() => LogManager.Write("Benchmark log message: cycle=12345 value=3.14", LogType.Info);
+}
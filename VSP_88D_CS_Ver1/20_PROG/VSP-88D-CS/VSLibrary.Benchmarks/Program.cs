@@ -0,0 +1,13 @@
+﻿using BenchmarkDotNet.Running;
+
+namespace VSLibrary.Benchmarks;
+
+/// <summary>
+/// VSLibrary 핫패스 벤치마크 진입점.
+/// 예) dotnet run -c Release -- --filter *Checksum*
+/// </summary>
+public static class Program
+{
+    public static void Main(string[] args)
+        => BenchmarkSwitcher.FromAssembly(typeof(Program).Assembly).Run(args, BenchmarkConfig.Create());
+}
@@ -0,0 +1,139 @@
+﻿using System.Collections.Concurrent;
+using System.Diagnostics;
+using BenchmarkDotNet.Attributes;
+using BenchmarkDotNet.Columns;
+using BenchmarkDotNet.Configs;
+using BenchmarkDotNet.Reports;
+using BenchmarkDotNet.Running;
+using VSLibrary.Threading;
+
+namespace VSLibrary.Benchmarks;
+
+/// <summary>
+/// ThreadBase 주기(실행 + 우선순위별 Sleep)의 실제 주기 길이와 흔들림.
+/// Mean은 Cycles 주기의 평균 길이입니다. 평균은 개별 주기의 튐을 가리므로
+/// 스레드 액션 안에서 주기마다 Stopwatch 간격을 기록하여 Cycle Max / P95 / P99 열로 따로 보고합니다.
+/// 기록한 값을 요약 열에서 읽어야 하므로 InProcess로 실행합니다.
+/// </summary>
+[InProcess]
+[Config(typeof(CycleColumnConfig))]
+public class ThreadCycleBenchmarks
+{
+    private const int Cycles = 20;
+
+    // 우선순위별 주기 길이 기록 (ms)
+    private static readonly ConcurrentDictionary<ThreadPriorityLevel, List<double>> CycleSamples = new();
+
+    private readonly SemaphoreSlim _tick = new(0);
+    private VirtualThread _thread = null!;
+    private List<double> _samples = null!;
+    private long _lastTimestamp;
+
+    [Params(ThreadPriorityLevel.High, ThreadPriorityLevel.Medium, ThreadPriorityLevel.Low)]
+    public ThreadPriorityLevel Priority;
+
+    [GlobalSetup]
+    public void Setup()
+    {
+        _samples = new List<double>();
+        CycleSamples[Priority] = _samples;
+        _lastTimestamp = 0;
+
+        _thread = new VirtualThread($"Bench{Priority}", _ => OnCycle(), Priority, 0);
+    }
+
+    [GlobalCleanup]
+    public void Cleanup()
+    {
+        _thread.Stop();
+    }
+
+    /// <summary>
+    /// 스레드 액션: 직전 주기와의 간격을 기록하고 벤치마크 쪽에 주기를 알립니다.
+    /// </summary>
+    private void OnCycle()
+    {
+        long now = Stopwatch.GetTimestamp();
+        if (_lastTimestamp != 0)
+        {
+            lock (_samples)
+                _samples.Add((now - _lastTimestamp) * 1000.0 / Stopwatch.Frequency);
+        }
+        _lastTimestamp = now;
+        _tick.Release();
+    }
+
+    /// <summary>
+    /// 반복 사이에 쌓인 주기를 버리고 다음 주기 경계에 맞춥니다.
+    /// </summary>
+    [IterationSetup]
+    public void Align()
+    {
+        while (_tick.Wait(0)) { }
+        _tick.Wait();
+    }
+
+    [Benchmark(OperationsPerInvoke = Cycles)]
+    public void Cycle()
+    {
+        for (int i = 0; i < Cycles; i++)
+            _tick.Wait();
+    }
+
+    /// <summary>
+    /// 주기별 기록에서 계산하는 요약 열
+    /// </summary>
+    public class CycleColumnConfig : ManualConfig
+    {
+        public CycleColumnConfig()
+        {
+            AddColumn(
+                new CycleColumn("Cycle P95 [ms]", 95),
+                new CycleColumn("Cycle P99 [ms]", 99),
+                new CycleColumn("Cycle Max [ms]", 100));
+        }
+    }
+
+    private sealed class CycleColumn : IColumn
+    {
+        private readonly double _percentile;
+
+        public CycleColumn(string name, double percentile)
+        {
+            ColumnName = name;
+            _percentile = percentile;
+        }
+
+        public string Id => nameof(CycleColumn) + ColumnName;
+        public string ColumnName { get; }
+        public bool AlwaysShow => true;
+        public ColumnCategory Category => ColumnCategory.Statistics;
+        public int PriorityInCategory => 100;
+        public bool IsNumeric => true;
+        public UnitType UnitType => UnitType.Dimensionless;
+        public string Legend => $"Per-cycle period percentile ({_percentile}) recorded inside the thread action";
+
+        public bool IsAvailable(Summary summary) => true;
+        public bool IsDefault(Summary summary, BenchmarkCase benchmarkCase) => false;
+
+        public string GetValue(Summary summary, BenchmarkCase benchmarkCase)
+            => GetValue(summary, benchmarkCase, SummaryStyle.Default);
+
+        public string GetValue(Summary summary, BenchmarkCase benchmarkCase, SummaryStyle style)
+        {
+            if (benchmarkCase.Parameters["Priority"] is not ThreadPriorityLevel priority
+                || !CycleSamples.TryGetValue(priority, out var samples))
+                return "NA";
+
+            double[] sorted;
+            lock (samples)
+                sorted = samples.ToArray();
+            if (sorted.Length == 0)
+                return "NA";
+
+            Array.Sort(sorted);
+            int rank = (int)Math.Ceiling(_percentile / 100.0 * sorted.Length) - 1;
+            return sorted[Math.Clamp(rank, 0, sorted.Length - 1)].ToString("0.000");
+        }
+    }
+}
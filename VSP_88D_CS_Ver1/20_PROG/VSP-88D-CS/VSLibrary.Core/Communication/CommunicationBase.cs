@@ -1,12 +1,12 @@
 ﻿using CommunityToolkit.Mvvm.ComponentModel;
-using Org.BouncyCastle.Asn1.X509.Qualified;
-using Org.BouncyCastle.Utilities;
 using System;
+using System.Buffers;
 using System.Collections.Generic;
 using System.Linq;
 using System.Reflection;
 using System.Text;
 using System.Threading.Tasks;
+using VSLibrary.Communication.Packet.Checksum;
 
 namespace VSLibrary.Communication
 {
@@ -416,63 +416,45 @@ namespace VSLibrary.Communication
 
     /// <summary>
     /// 공통 CRC/LRC/이스케이프 기능을 제공하는 추상 클래스
+    /// 실제 계산은 <see cref="PacketChecksum"/> 의 테이블/벡터 커널에 위임합니다.
     /// </summary>
     public class PacketHelper
     {
         // CRC-16 계산 (Modbus RTU 등)
         protected ushort ComputeCrc16(byte[] data, int offset, int length)
-        {
-            ushort crc = 0xFFFF;
-            for (int i = offset; i < offset + length; i++)
-            {
-                crc ^= data[i];
-                for (int j = 0; j < 8; j++)
-                    crc = (ushort)((crc & 1) != 0 ? (crc >> 1) ^ 0xA001 : crc >> 1);
-            }
-            return crc;
-        }
+            => PacketChecksum.ComputeCrc16(data.AsSpan(offset, length));
+
+        protected ushort ComputeCrc16(ReadOnlySpan<byte> data)
+            => PacketChecksum.ComputeCrc16(data);
+
+        protected ushort ComputeCrc16(in ReadOnlySequence<byte> data)
+            => PacketChecksum.ComputeCrc16(data);
 
         // LRC 계산 (Modbus ASCII 등)
         protected byte ComputeLrc(byte[] data, int offset, int length)
-        {
-            byte sum = 0;
-            for (int i = offset; i < offset + length; i++)
-                unchecked { sum += data[i]; }
-            return (byte)((sum ^ 0xFF) + 1);
-        }
+            => PacketChecksum.ComputeLrc(data.AsSpan(offset, length));
 
-        // CRC-32 계산 (Ethernet, ZIP 등)
-        // (표 기반으로 0xEDB88320 다항식을 사용)
-        private static readonly uint[] Crc32Table;
-
-        // 정적 생성자에서 테이블 초기화
-        static PacketHelper()
-        {
-            const uint polynomial = 0xEDB88320;
-            Crc32Table = new uint[256];
-            for (uint i = 0; i < 256; i++)
-            {
-                uint crc = i;
-                for (int j = 0; j < 8; j++)
-                    crc = (crc & 1) != 0
-                        ? (crc >> 1) ^ polynomial
-                        : crc >> 1;
-                Crc32Table[i] = crc;
-            }
-        }
+        protected byte ComputeLrc(ReadOnlySpan<byte> data)
+            => PacketChecksum.ComputeLrc(data);
 
         /// <summary>
         /// data[offset]부터 length 바이트를 읽어 CRC-32를 계산하여 반환합니다.
         /// </summary>
         protected uint ComputeCrc32(byte[] data, int offset, int length)
-        {
-            uint crc = 0xFFFFFFFF;
-            for (int i = offset; i < offset + length; i++)
-            {
-                crc = (crc >> 8) ^ Crc32Table[(crc ^ data[i]) & 0xFF];
-            }
-            return crc ^ 0xFFFFFFFF;
-        }
+            => PacketChecksum.ComputeCrc32(data.AsSpan(offset, length));
+
+        protected uint ComputeCrc32(ReadOnlySpan<byte> data)
+            => PacketChecksum.ComputeCrc32(data);
+
+        protected uint ComputeCrc32(in ReadOnlySequence<byte> data)
+            => PacketChecksum.ComputeCrc32(data);
+
+        // HEX 인코딩/디코딩 (Modbus ASCII 등)
+        protected bool TryEncodeHex(ReadOnlySpan<byte> source, Span<byte> destination, out int bytesWritten)
+            => PacketChecksum.TryEncodeHex(source, destination, out bytesWritten);
+
+        protected bool TryDecodeHex(ReadOnlySpan<byte> source, Span<byte> destination, out int bytesWritten)
+            => PacketChecksum.TryDecodeHex(source, destination, out bytesWritten);
 
         // 필요하다면 이스케이프, 프레임 구분자 헬퍼 등 추가
     }
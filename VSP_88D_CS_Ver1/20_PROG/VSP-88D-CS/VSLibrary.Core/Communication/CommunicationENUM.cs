@@ -19,6 +19,8 @@ namespace VSLibrary.Communication
         TestModbusTCP,
         PlasourceRFGenerator,
         YoungshinRFGenerator,
+        TestLoopback,
+        TestModbusSimulator,
     }
 
     public enum CommunicationEventType
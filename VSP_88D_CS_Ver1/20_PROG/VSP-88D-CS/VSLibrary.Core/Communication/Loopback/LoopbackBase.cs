@@ -0,0 +1,165 @@
+﻿using CommunityToolkit.Mvvm.ComponentModel;
+using System;
+using System.Threading;
+using System.Threading.Tasks;
+using VSLibrary.Communication;
+
+namespace VSLibrary.Communication.Loopback
+{
+    /// <summary>
+    /// 메모리 내 루프백 통신 추상 클래스
+    /// 실제 포트/네트워크 없이 송신 데이터를 응답 생성(OnLoopback) 또는 연결된 상대(Connect)에게 넘기고,
+    /// 돌아온 바이트는 CommunicationBase.ProcessReceivedBytes 로 전달하여 프레임 분리/요청-응답 매칭을 그대로 탑니다.
+    /// </summary>
+    public abstract partial class LoopbackBase : CommunicationBase
+    {
+        // 연결된 상대편 (null이면 OnLoopback 응답을 자기 자신에게 수신)
+        private LoopbackBase? _peer;
+
+        // 수신 처리 직렬화 (SerialPort.DataReceived 처럼 한 번에 한 조각씩)
+        private readonly object _rxLock = new();
+
+        /// <summary>응답 도착 지연 (ms, 0이면 WriteCoreAsync 안에서 즉시 수신)</summary>
+        [ObservableProperty]
+        private int _latencyMs = 0;
+
+        /// <summary>수신 조각 크기 (0이면 한 번에 전달, 그 외에는 시리얼처럼 잘라서 전달)</summary>
+        [ObservableProperty]
+        private int _chunkSize = 0;
+
+        protected LoopbackBase(ICommunicationConfig config)
+        {
+            Config = config ?? throw new ArgumentNullException(nameof(config));
+        }
+
+        /// <summary>
+        /// 두 루프백 채널을 서로 연결합니다. 한쪽의 송신이 다른 쪽의 수신이 됩니다.
+        /// </summary>
+        public void Connect(LoopbackBase peer)
+        {
+            _peer = peer ?? throw new ArgumentNullException(nameof(peer));
+            peer._peer = this;
+        }
+
+        /// <summary>
+        /// 상대가 없을 때 송신 데이터에 대한 응답을 만듭니다. (기본: 에코)
+        /// null을 반환하면 응답하지 않습니다.
+        /// </summary>
+        protected virtual byte[]? OnLoopback(byte[] data) => data;
+
+        /// <summary>
+        /// 실제 쓰기: 상대 또는 자기 자신에게 바이트를 전달
+        /// </summary>
+        protected override Task WriteCoreAsync(byte[] data, CancellationToken cancellationToken)
+        {
+            if (!IsOpen)
+            {
+                EventMessage(Config.CommunicationName, CommunicationEventType.TxError, "Loopback is not open.");
+                return Task.CompletedTask;
+            }
+
+            var target = _peer ?? this;
+            var rx = _peer != null ? data : OnLoopback(data);
+            if (rx == null || rx.Length == 0)
+                return Task.CompletedTask;
+
+            if (LatencyMs <= 0)
+            {
+                target.Deliver(rx);
+            }
+            else
+            {
+                _ = Task.Delay(LatencyMs, CancellationToken.None).ContinueWith(_ => target.Deliver(rx), TaskScheduler.Default);
+            }
+
+            return Task.CompletedTask;
+        }
+
+        /// <summary>
+        /// 수신된 바이트를 CommunicationBase.ProcessReceivedBytes로 전달
+        /// </summary>
+        private void Deliver(byte[] data)
+        {
+            if (!IsOpen) return;
+
+            try
+            {
+                lock (_rxLock)
+                {
+                    if (ChunkSize <= 0 || data.Length <= ChunkSize)
+                    {
+                        ProcessReceivedBytes(data);
+                        return;
+                    }
+
+                    for (int offset = 0; offset < data.Length; offset += ChunkSize)
+                    {
+                        int len = Math.Min(ChunkSize, data.Length - offset);
+                        ProcessReceivedBytes(data.AsSpan(offset, len).ToArray());
+                    }
+                }
+            }
+            catch (Exception ex)
+            {
+                EventMessage(Config.CommunicationName, CommunicationEventType.RxError, $"Loopback receive error: {ex}");
+            }
+        }
+
+        /// <summary>
+        /// 열기 및 주기 작업 시작
+        /// </summary>
+        public override async Task OpenAsync(CancellationToken cancellationToken = default)
+        {
+            if (IsOpen) return;
+
+            IsOpen = true;
+            EventMessage(Config.CommunicationName, CommunicationEventType.Connected, "Loopback open");
+
+            if (ShouldAutoInitialize)
+            {
+                await InitializeAsync();
+                await OnDoworkAsync(cancellationToken);
+            }
+        }
+
+        /// <summary>
+        /// 닫기
+        /// </summary>
+        public override Task CloseAsync(CancellationToken cancellationToken = default)
+        {
+            OffDoworkAsync();
+            if (IsOpen)
+            {
+                IsOpen = false;
+                EventMessage(Config.CommunicationName, CommunicationEventType.Disconnected, "Loopback close");
+            }
+            return Task.CompletedTask;
+        }
+
+        public override Task OnDoworkAsync(CancellationToken cancellationToken = default)
+        {
+            if (_isWorking)
+                return Task.CompletedTask;
+
+            _doWorkCts = new CancellationTokenSource();
+            _isWorking = true;
+            _ = DoWorkAsync().ContinueWith(t =>
+            {
+                // 작업이 끝나거나 중단되면 상태 초기화
+                _isWorking = false;
+            }, TaskScheduler.Default);
+
+            return Task.CompletedTask;
+        }
+
+        public override Task OffDoworkAsync(CancellationToken cancellationToken = default)
+        {
+            if (!_isWorking || _doWorkCts == null || _doWorkCts.IsCancellationRequested)
+                return Task.CompletedTask;
+
+            try { _doWorkCts.Cancel(); } catch { }
+
+            return Task.CompletedTask;
+        }
+    }
+}
@@ -0,0 +1,35 @@
+﻿using System.IO.Ports;
+
+namespace VSLibrary.Communication.Loopback
+{
+    /// <summary>
+    /// 루프백 채널용 최소 통신 설정
+    /// 포트/호스트 설정이 필요 없는 LoopbackBase 파생 클래스를 UI(CommunicationConfig) 없이 만들 때 사용합니다.
+    /// </summary>
+    public sealed class LoopbackConfig : ICommunicationConfig
+    {
+        public string CommunicationName { get; set; } = "";
+        public CommunicationTarget Target { get; set; }
+
+        // Serial/TCP 설정은 루프백에서 사용하지 않음
+        public string PortName { get; set; } = "";
+        public int BaudRate { get; set; }
+        public Parity Parity { get; set; }
+        public int DataBits { get; set; }
+        public StopBits StopBits { get; set; }
+        public string Host { get; set; } = "";
+        public int Port { get; set; }
+
+        public bool BackgroundPacket { get; set; } = true;
+
+        public LoopbackConfig()
+        {
+        }
+
+        public LoopbackConfig(string name, CommunicationTarget target)
+        {
+            CommunicationName = name;
+            Target = target;
+        }
+    }
+}
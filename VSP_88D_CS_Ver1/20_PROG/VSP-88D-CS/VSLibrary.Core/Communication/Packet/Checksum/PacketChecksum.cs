@@ -0,0 +1,447 @@
+﻿using System;
+using System.Buffers;
+using System.Buffers.Binary;
+using System.Runtime.CompilerServices;
+using System.Runtime.Intrinsics;
+using System.Runtime.Intrinsics.X86;
+using ArmCrc32 = System.Runtime.Intrinsics.Arm.Crc32;
+
+namespace VSLibrary.Communication.Packet.Checksum
+{
+    /// <summary>
+    /// 시리얼/소켓 프레임에 공통으로 쓰이는 CRC-16(Modbus), CRC-32, LRC, HEX(ASCII) 인코딩 커널입니다.
+    /// 모든 API는 Span 기반이며 배열 복사 없이 동작합니다.
+    /// </summary>
+    /// <remarks>
+    /// 검증 값 ("123456789" ASCII):
+    /// CRC-16/Modbus = 0x4B37, CRC-32 = 0xCBF43926
+    /// </remarks>
+    public static class PacketChecksum
+    {
+        /// <summary>CRC-16/Modbus 레지스터 초기값</summary>
+        public const ushort Crc16Seed = 0xFFFF;
+
+        /// <summary>CRC-32 레지스터 초기값 (최종 결과는 비트 반전)</summary>
+        public const uint Crc32Seed = 0xFFFFFFFF;
+
+        private const ushort Crc16Polynomial = 0xA001;   // 0x8005 reflected
+        private const uint Crc32Polynomial = 0xEDB88320; // 0x04C11DB7 reflected
+
+        // Slicing-by-8 테이블: [k * 256 + i] = 바이트 i 뒤에 k 바이트가 더 이어질 때의 기여분
+        private static readonly ushort[] Crc16Table = BuildCrc16Table();
+        private static readonly uint[] Crc32Table = BuildCrc32Table();
+
+        private static ushort[] BuildCrc16Table()
+        {
+            var table = new ushort[8 * 256];
+            for (int i = 0; i < 256; i++)
+            {
+                ushort crc = (ushort)i;
+                for (int j = 0; j < 8; j++)
+                    crc = (ushort)((crc & 1) != 0 ? (crc >> 1) ^ Crc16Polynomial : crc >> 1);
+                table[i] = crc;
+            }
+            for (int k = 1; k < 8; k++)
+            {
+                for (int i = 0; i < 256; i++)
+                {
+                    ushort prev = table[(k - 1) * 256 + i];
+                    table[k * 256 + i] = (ushort)((prev >> 8) ^ table[prev & 0xFF]);
+                }
+            }
+            return table;
+        }
+
+        private static uint[] BuildCrc32Table()
+        {
+            var table = new uint[8 * 256];
+            for (uint i = 0; i < 256; i++)
+            {
+                uint crc = i;
+                for (int j = 0; j < 8; j++)
+                    crc = (crc & 1) != 0 ? (crc >> 1) ^ Crc32Polynomial : crc >> 1;
+                table[i] = crc;
+            }
+            for (int k = 1; k < 8; k++)
+            {
+                for (int i = 0; i < 256; i++)
+                {
+                    uint prev = table[(k - 1) * 256 + i];
+                    table[k * 256 + i] = (prev >> 8) ^ table[prev & 0xFF];
+                }
+            }
+            return table;
+        }
+
+        #region CRC-16 (Modbus RTU)
+
+        /// <summary>
+        /// 데이터 전체의 CRC-16/Modbus 값을 계산합니다.
+        /// 프레임에는 하위 바이트가 먼저 실립니다.
+        /// </summary>
+        public static ushort ComputeCrc16(ReadOnlySpan<byte> data) => UpdateCrc16(Crc16Seed, data);
+
+        /// <summary>
+        /// 여러 세그먼트로 나뉜 프레임의 CRC-16/Modbus 값을 계산합니다.
+        /// </summary>
+        public static ushort ComputeCrc16(in ReadOnlySequence<byte> data)
+        {
+            if (data.IsSingleSegment)
+                return UpdateCrc16(Crc16Seed, data.FirstSpan);
+
+            ushort crc = Crc16Seed;
+            foreach (var segment in data)
+                crc = UpdateCrc16(crc, segment.Span);
+            return crc;
+        }
+
+        /// <summary>
+        /// 스트리밍 계산용: 이전 레지스터 값에 data를 이어서 반영합니다.
+        /// 첫 호출에는 <see cref="Crc16Seed"/>를 넘기고, 반환값이 곧 CRC 입니다.
+        /// </summary>
+        public static ushort UpdateCrc16(ushort crc, ReadOnlySpan<byte> data)
+        {
+            ushort[] t = Crc16Table;
+
+            while (data.Length >= 8)
+            {
+                uint one = BinaryPrimitives.ReadUInt16LittleEndian(data) ^ (uint)crc;
+                crc = (ushort)(
+                    t[7 * 256 + (one & 0xFF)] ^
+                    t[6 * 256 + (one >> 8)] ^
+                    t[5 * 256 + data[2]] ^
+                    t[4 * 256 + data[3]] ^
+                    t[3 * 256 + data[4]] ^
+                    t[2 * 256 + data[5]] ^
+                    t[1 * 256 + data[6]] ^
+                    t[data[7]]);
+                data = data.Slice(8);
+            }
+
+            foreach (byte b in data)
+                crc = (ushort)((crc >> 8) ^ t[(crc ^ b) & 0xFF]);
+
+            return crc;
+        }
+
+        #endregion
+
+        #region CRC-32 (IEEE 802.3)
+
+        /// <summary>
+        /// 데이터 전체의 CRC-32 값을 계산합니다.
+        /// </summary>
+        public static uint ComputeCrc32(ReadOnlySpan<byte> data) => ~UpdateCrc32(Crc32Seed, data);
+
+        /// <summary>
+        /// 여러 세그먼트로 나뉜 프레임의 CRC-32 값을 계산합니다.
+        /// </summary>
+        public static uint ComputeCrc32(in ReadOnlySequence<byte> data)
+        {
+            if (data.IsSingleSegment)
+                return ~UpdateCrc32(Crc32Seed, data.FirstSpan);
+
+            uint crc = Crc32Seed;
+            foreach (var segment in data)
+                crc = UpdateCrc32(crc, segment.Span);
+            return ~crc;
+        }
+
+        /// <summary>
+        /// 스트리밍 계산용: 반전 전의 레지스터 값에 data를 이어서 반영합니다.
+        /// 첫 호출에는 <see cref="Crc32Seed"/>를 넘기고, 마지막에 비트 반전(~)한 값이 CRC 입니다.
+        /// </summary>
+        /// <remarks>
+        /// ARM64 는 CRC32 명령, x64 는 PCLMULQDQ(carry-less multiply) 폴딩, 그 외에는 Slicing-by-8 테이블을 사용합니다.
+        /// x86 SSE4.2 crc32 명령은 CRC-32C(Castagnoli) 다항식이라 여기서는 쓰지 않습니다.
+        /// </remarks>
+        public static uint UpdateCrc32(uint crc, ReadOnlySpan<byte> data)
+        {
+            if (ArmCrc32.Arm64.IsSupported)
+                return UpdateCrc32Arm64(crc, data);
+
+            if (Pclmulqdq.IsSupported && data.Length >= Crc32FoldMinLength)
+                return UpdateCrc32Pclmul(crc, data);
+
+            return UpdateCrc32Table(crc, data);
+        }
+
+        /// <summary>Slicing-by-8 테이블 경로 (테스트에서 하드웨어 경로와 비교하기 위해 internal)</summary>
+        internal static uint UpdateCrc32Table(uint crc, ReadOnlySpan<byte> data)
+        {
+            uint[] t = Crc32Table;
+
+            while (data.Length >= 8)
+            {
+                uint one = BinaryPrimitives.ReadUInt32LittleEndian(data) ^ crc;
+                uint two = BinaryPrimitives.ReadUInt32LittleEndian(data.Slice(4));
+                crc =
+                    t[7 * 256 + (one & 0xFF)] ^
+                    t[6 * 256 + ((one >> 8) & 0xFF)] ^
+                    t[5 * 256 + ((one >> 16) & 0xFF)] ^
+                    t[4 * 256 + (one >> 24)] ^
+                    t[3 * 256 + (two & 0xFF)] ^
+                    t[2 * 256 + ((two >> 8) & 0xFF)] ^
+                    t[1 * 256 + ((two >> 16) & 0xFF)] ^
+                    t[two >> 24];
+                data = data.Slice(8);
+            }
+
+            foreach (byte b in data)
+                crc = (crc >> 8) ^ t[(crc ^ b) & 0xFF];
+
+            return crc;
+        }
+
+        /// <summary>ARM64 CRC32 명령 경로 (<see cref="ArmCrc32.Arm64.IsSupported"/>일 때만 호출)</summary>
+        internal static uint UpdateCrc32Arm64(uint crc, ReadOnlySpan<byte> data)
+        {
+            while (data.Length >= 8)
+            {
+                crc = ArmCrc32.Arm64.ComputeCrc32(crc, BinaryPrimitives.ReadUInt64LittleEndian(data));
+                data = data.Slice(8);
+            }
+
+            foreach (byte b in data)
+                crc = ArmCrc32.ComputeCrc32(crc, b);
+
+            return crc;
+        }
+
+        // PCLMULQDQ 폴딩 상수 (비트 반전 도메인, Intel "Fast CRC Computation Using PCLMULQDQ" 백서)
+        private const int Crc32FoldMinLength = 64;
+        // k1..k5: 폴딩 거리별 x^n mod P, PolyP/PolyMu: Barrett 축약용 P' 와 u'
+        private const ulong Crc32K1 = 0x0154442BD4;
+        private const ulong Crc32K2 = 0x01C6E41596;
+        private const ulong Crc32K3 = 0x01751997D0;
+        private const ulong Crc32K4 = 0x00CCAA009E;
+        private const ulong Crc32K5 = 0x0163CD6124;
+        private const ulong Crc32PolyP = 0x01DB710641;
+        private const ulong Crc32PolyMu = 0x01F7011641;
+
+        /// <summary>
+        /// x64 PCLMULQDQ 경로 (<see cref="Pclmulqdq.IsSupported"/>일 때만 호출).
+        /// 64바이트 이상은 4×128비트 폴딩 후 Barrett 축약하고, 16바이트 미만 나머지는 테이블로 처리합니다.
+        /// </summary>
+        internal static uint UpdateCrc32Pclmul(uint crc, ReadOnlySpan<byte> data)
+        {
+            if (data.Length < Crc32FoldMinLength)
+                return UpdateCrc32Table(crc, data);
+
+            var x1 = Vector128.Create(data).AsUInt64() ^ Vector128.CreateScalar(crc).AsUInt64();
+            var x2 = Vector128.Create(data.Slice(16)).AsUInt64();
+            var x3 = Vector128.Create(data.Slice(32)).AsUInt64();
+            var x4 = Vector128.Create(data.Slice(48)).AsUInt64();
+            data = data.Slice(64);
+
+            // 64바이트씩 4개 레인을 병렬로 폴딩
+            var k1k2 = Vector128.Create(Crc32K1, Crc32K2);
+            while (data.Length >= 64)
+            {
+                x1 = Fold(x1, k1k2) ^ Vector128.Create(data).AsUInt64();
+                x2 = Fold(x2, k1k2) ^ Vector128.Create(data.Slice(16)).AsUInt64();
+                x3 = Fold(x3, k1k2) ^ Vector128.Create(data.Slice(32)).AsUInt64();
+                x4 = Fold(x4, k1k2) ^ Vector128.Create(data.Slice(48)).AsUInt64();
+                data = data.Slice(64);
+            }
+
+            // 4개 레인을 128비트 하나로 합친 뒤 16바이트씩 폴딩
+            var k3k4 = Vector128.Create(Crc32K3, Crc32K4);
+            x1 = Fold(x1, k3k4) ^ x2;
+            x1 = Fold(x1, k3k4) ^ x3;
+            x1 = Fold(x1, k3k4) ^ x4;
+            while (data.Length >= 16)
+            {
+                x1 = Fold(x1, k3k4) ^ Vector128.Create(data).AsUInt64();
+                data = data.Slice(16);
+            }
+
+            // 128 → 64비트
+            var low32 = Vector128.Create(0x00000000FFFFFFFFUL);
+            x1 = Sse2.ShiftRightLogical128BitLane(x1, 8) ^ Pclmulqdq.CarrylessMultiply(x1, k3k4, 0x10);
+            var x2r = Sse2.ShiftRightLogical128BitLane(x1, 4);
+            x1 = Pclmulqdq.CarrylessMultiply(x1 & low32, Vector128.CreateScalar(Crc32K5), 0x00) ^ x2r;
+
+            // Barrett 축약 → 32비트
+            var poly = Vector128.Create(Crc32PolyP, Crc32PolyMu);
+            var t = Pclmulqdq.CarrylessMultiply(x1 & low32, poly, 0x10) & low32;
+            t = Pclmulqdq.CarrylessMultiply(t, poly, 0x00);
+            crc = (x1 ^ t).AsUInt32().GetElement(1);
+
+            return UpdateCrc32Table(crc, data);
+        }
+
+        [MethodImpl(MethodImplOptions.AggressiveInlining)]
+        private static Vector128<ulong> Fold(Vector128<ulong> x, Vector128<ulong> k)
+            => Pclmulqdq.CarrylessMultiply(x, k, 0x00) ^ Pclmulqdq.CarrylessMultiply(x, k, 0x11);
+
+        #endregion
+
+        #region LRC (Modbus ASCII)
+
+        /// <summary>
+        /// Modbus ASCII LRC (바이트 합의 2의 보수)를 계산합니다.
+        /// data는 HEX 디코딩된 이진 데이터(주소 ~ 데이터)입니다.
+        /// </summary>
+        public static byte ComputeLrc(ReadOnlySpan<byte> data)
+        {
+            byte sum = 0;
+
+            if (Vector128.IsHardwareAccelerated && data.Length >= Vector128<byte>.Count)
+            {
+                // 바이트 단위 덧셈은 lane 별로 mod 256 누적되므로 마지막에 합쳐도 결과가 같습니다.
+                var acc = Vector128<byte>.Zero;
+                while (data.Length >= Vector128<byte>.Count)
+                {
+                    acc += Vector128.Create(data);
+                    data = data.Slice(Vector128<byte>.Count);
+                }
+                sum = Vector128.Sum(acc);
+            }
+
+            foreach (byte b in data)
+                unchecked { sum += b; }
+
+            return unchecked((byte)-sum);
+        }
+
+        #endregion
+
+        #region HEX (Modbus ASCII)
+
+        /// <summary>
+        /// 이진 데이터를 대문자 ASCII HEX 로 인코딩합니다. (1바이트 → 2문자)
+        /// </summary>
+        /// <returns>destination 길이가 부족하면 false</returns>
+        public static bool TryEncodeHex(ReadOnlySpan<byte> source, Span<byte> destination, out int bytesWritten)
+        {
+            bytesWritten = 0;
+            if (destination.Length < source.Length * 2)
+                return false;
+
+            int i = 0;
+            if (Vector128.IsHardwareAccelerated)
+            {
+                var mask = Vector128.Create((byte)0x0F);
+                var nine = Vector128.Create((byte)9);
+                var zero = Vector128.Create((byte)'0');
+                var alphaGap = Vector128.Create((byte)('A' - '0' - 10));
+
+                for (; i + Vector128<byte>.Count <= source.Length; i += Vector128<byte>.Count)
+                {
+                    var v = Vector128.Create(source.Slice(i));
+                    var hi = ToHexDigits(Vector128.ShiftRightLogical(v, 4) & mask, nine, zero, alphaGap);
+                    var lo = ToHexDigits(v & mask, nine, zero, alphaGap);
+
+                    // 리틀엔디안 ushort = [hi, lo] 순서로 바이트를 교차 배치
+                    var (hiLower, hiUpper) = Vector128.Widen(hi);
+                    var (loLower, loUpper) = Vector128.Widen(lo);
+                    var first = hiLower | Vector128.ShiftLeft(loLower, 8);
+                    var second = hiUpper | Vector128.ShiftLeft(loUpper, 8);
+
+                    first.AsByte().CopyTo(destination.Slice(i * 2));
+                    second.AsByte().CopyTo(destination.Slice(i * 2 + Vector128<byte>.Count));
+                }
+            }
+
+            for (; i < source.Length; i++)
+            {
+                byte b = source[i];
+                destination[i * 2] = ToHexDigit(b >> 4);
+                destination[i * 2 + 1] = ToHexDigit(b & 0x0F);
+            }
+
+            bytesWritten = source.Length * 2;
+            return true;
+        }
+
+        /// <summary>
+        /// ASCII HEX 를 이진 데이터로 디코딩합니다. (2문자 → 1바이트, 대소문자 무관)
+        /// </summary>
+        /// <returns>길이가 홀수이거나 HEX 가 아닌 문자가 있거나 destination 이 부족하면 false</returns>
+        public static bool TryDecodeHex(ReadOnlySpan<byte> source, Span<byte> destination, out int bytesWritten)
+        {
+            bytesWritten = 0;
+            if ((source.Length & 1) != 0 || destination.Length < source.Length / 2)
+                return false;
+
+            int i = 0;
+            if (Vector128.IsHardwareAccelerated)
+            {
+                var ten = Vector128.Create((byte)10);
+                var six = Vector128.Create((byte)6);
+                var zero = Vector128.Create((byte)'0');
+                var lowerA = Vector128.Create((byte)'a');
+                var caseBit = Vector128.Create((byte)0x20);
+                var lowByte = Vector128.Create((ushort)0x00FF);
+
+                for (; i + 2 * Vector128<byte>.Count <= source.Length; i += 2 * Vector128<byte>.Count)
+                {
+                    if (!TryFromHexDigits(Vector128.Create(source.Slice(i)), ten, six, zero, lowerA, caseBit, out var first) ||
+                        !TryFromHexDigits(Vector128.Create(source.Slice(i + Vector128<byte>.Count)), ten, six, zero, lowerA, caseBit, out var second))
+                        return false;
+
+                    // 각 ushort 의 [하위=상위니블, 상위=하위니블] 을 한 바이트로 합침
+                    var a = first.AsUInt16();
+                    var b = second.AsUInt16();
+                    a = Vector128.ShiftLeft(a & lowByte, 4) | Vector128.ShiftRightLogical(a, 8);
+                    b = Vector128.ShiftLeft(b & lowByte, 4) | Vector128.ShiftRightLogical(b, 8);
+
+                    Vector128.Narrow(a, b).CopyTo(destination.Slice(i / 2));
+                }
+            }
+
+            for (; i < source.Length; i += 2)
+            {
+                int hi = FromHexDigit(source[i]);
+                int lo = FromHexDigit(source[i + 1]);
+                if ((hi | lo) < 0)
+                    return false;
+                destination[i / 2] = (byte)((hi << 4) | lo);
+            }
+
+            bytesWritten = source.Length / 2;
+            return true;
+        }
+
+        [MethodImpl(MethodImplOptions.AggressiveInlining)]
+        private static Vector128<byte> ToHexDigits(Vector128<byte> nibbles, Vector128<byte> nine, Vector128<byte> zero, Vector128<byte> alphaGap)
+        {
+            var isAlpha = Vector128.GreaterThan(nibbles, nine);
+            return nibbles + zero + (isAlpha & alphaGap);
+        }
+
+        [MethodImpl(MethodImplOptions.AggressiveInlining)]
+        private static bool TryFromHexDigits(Vector128<byte> chars, Vector128<byte> ten, Vector128<byte> six,
+            Vector128<byte> zero, Vector128<byte> lowerA, Vector128<byte> caseBit, out Vector128<byte> nibbles)
+        {
+            var digit = chars - zero;
+            var alpha = (chars | caseBit) - lowerA;
+            var isDigit = Vector128.LessThan(digit, ten);
+            var isAlpha = Vector128.LessThan(alpha, six);
+
+            nibbles = Vector128.ConditionalSelect(isDigit, digit, alpha + ten);
+            return (isDigit | isAlpha) == Vector128<byte>.AllBitsSet;
+        }
+
+        [MethodImpl(MethodImplOptions.AggressiveInlining)]
+        private static byte ToHexDigit(int nibble) =>
+            (byte)(nibble < 10 ? '0' + nibble : 'A' - 10 + nibble);
+
+        [MethodImpl(MethodImplOptions.AggressiveInlining)]
+        private static int FromHexDigit(byte c)
+        {
+            uint digit = (uint)(c - '0');
+            if (digit < 10)
+                return (int)digit;
+
+            uint alpha = (uint)((c | 0x20) - 'a');
+            if (alpha < 6)
+                return (int)alpha + 10;
+
+            return -1;
+        }
+
+        #endregion
+    }
+}
@@ -0,0 +1,199 @@
+﻿using CommunityToolkit.Mvvm.ComponentModel;
+using System;
+using System.Buffers.Binary;
+using System.Linq;
+using System.Text;
+using System.Threading.Tasks;
+using VSLibrary.Communication.Loopback;
+
+namespace VSLibrary.Communication.Packet.Modbus
+{
+    /// <summary>
+    /// 메모리 내 ModbusSlaveSimulator에 붙는 Modbus ASCII 마스터
+    /// ModbusASCII와 같은 IModbusMasterWrapper를 제공하지만 NModbus4/시리얼 포트 없이
+    /// CommunicationBase의 SendReceiveAsync/ProcessReceivedBytes 경로로 요청-응답을 처리합니다.
+    /// </summary>
+    public partial class ModbusSimulator : LoopbackBase, IModbusConfig, IModbusMasterWrapper
+    {
+        [ObservableProperty]
+        private int _readTimeout = 1000;
+
+        [ObservableProperty]
+        private int _writeTimeout = 1000;
+
+        [ObservableProperty]
+        private int _retryCount = 1;
+
+        /// <summary>응답하는 가상 슬레이브 (테이블을 직접 읽고 쓸 수 있음)</summary>
+        public ModbusSlaveSimulator Slave { get; }
+
+        public ModbusSimulator(ICommunicationConfig cfg)
+            : this(cfg, new ModbusSlaveSimulator())
+        {
+        }
+
+        public ModbusSimulator(ICommunicationConfig cfg, ModbusSlaveSimulator slave)
+            : base(cfg)
+        {
+            Slave = slave ?? throw new ArgumentNullException(nameof(slave));
+
+            // 시작문자 ':'는 프레임 디코딩에서 제거 (CRLF만으로 프레임 분리)
+            _startSeq = null;
+            _delimiter = Encoding.ASCII.GetBytes("\r\n");
+        }
+
+        /// <summary>
+        /// 송신된 ASCII 프레임을 가상 슬레이브가 처리하여 응답
+        /// </summary>
+        protected override byte[]? OnLoopback(byte[] data) => Slave.ProcessAsciiFrame(data);
+
+        #region 헬퍼 메서드
+
+        /// <summary>
+        /// 요청 PDU를 전송하고 응답 PDU 데이터(기능코드 이후)를 반환합니다.
+        /// 실패 시 ModbusASCII와 같은 이벤트를 남기고 null을 반환합니다.
+        /// </summary>
+        private async Task<byte[]?> TransactAsync(byte slaveId, byte function, byte[] pdu, string operation)
+        {
+            if (!IsOpen)
+            {
+                EventMessage(Config.CommunicationName, CommunicationEventType.UnexpectedEx, $"Op={operation}, Loopback closed.");
+                return null;
+            }
+
+            var adu = new byte[2 + pdu.Length];
+            adu[0] = slaveId;
+            adu[1] = function;
+            pdu.CopyTo(adu, 2);
+            var frame = ModbusSlaveSimulator.EncodeAsciiFrame(adu);
+
+            // 브로드캐스트(슬레이브 0)는 응답이 없으므로 송신만 하고 성공 처리
+            if (slaveId == 0)
+            {
+                await SendAsync(frame);
+                return Array.Empty<byte>();
+            }
+
+            for (int attempt = 0; attempt <= RetryCount; attempt++)
+            {
+                var packet = await SendReceiveAsync(frame, raw =>
+                    ModbusSlaveSimulator.TryDecodeAsciiFrame(raw, out var r)
+                    && r[0] == slaveId && (r[1] & 0x7F) == function, ReadTimeout);
+
+                if (packet == null || !ModbusSlaveSimulator.TryDecodeAsciiFrame(packet, out var response))
+                    continue;
+
+                if ((response[1] & 0x80) != 0)
+                {
+                    EventMessage(Config.CommunicationName, CommunicationEventType.SlaveEx,
+                        $"Op={operation}, Msg=Function Code: {function}, Exception Code: {response[2]}");
+                    return null;
+                }
+
+                return response.AsSpan(2).ToArray();
+            }
+
+            EventMessage(Config.CommunicationName, CommunicationEventType.Timeout, $"Op={operation}, Msg=No response.");
+            return null;
+        }
+
+        private static byte[] RangePdu(ushort addr, ushort len)
+        {
+            var pdu = new byte[4];
+            BinaryPrimitives.WriteUInt16BigEndian(pdu, addr);
+            BinaryPrimitives.WriteUInt16BigEndian(pdu.AsSpan(2), len);
+            return pdu;
+        }
+
+        private async Task<bool[]> ReadBitsAsync(byte function, ushort addr, ushort len, byte slaveId, string operation)
+        {
+            var data = await TransactAsync(slaveId, function, RangePdu(addr, len), operation);
+            if (data == null || data.Length < 1 + (len + 7) / 8)
+                return default;
+
+            var bits = new bool[len];
+            for (int i = 0; i < len; i++)
+                bits[i] = (data[1 + (i >> 3)] & (1 << (i & 7))) != 0;
+
+            Success(operation, string.Join(",", bits.Select(b => b ? "1" : "0")));
+            return bits;
+        }
+
+        private async Task<ushort[]> ReadRegistersAsync(byte function, ushort addr, ushort len, byte slaveId, string operation)
+        {
+            var data = await TransactAsync(slaveId, function, RangePdu(addr, len), operation);
+            if (data == null || data.Length < 1 + len * 2)
+                return default;
+
+            var regs = new ushort[len];
+            for (int i = 0; i < len; i++)
+                regs[i] = BinaryPrimitives.ReadUInt16BigEndian(data.AsSpan(1 + i * 2));
+
+            Success(operation, string.Join(",", regs));
+            return regs;
+        }
+
+        private async Task<bool> WriteAsync(byte function, byte[] pdu, byte slaveId, string operation)
+        {
+            var data = await TransactAsync(slaveId, function, pdu, operation);
+            if (data == null)
+                return false;
+
+            Success(operation, "OK");
+            return true;
+        }
+
+        private void Success(string operation, string payload)
+        {
+            EventMessage(Config.CommunicationName, CommunicationEventType.Success, $"Op={operation}, Result={payload}");
+        }
+
+        #endregion
+
+        #region IModbusMasterWrapper
+
+        public Task<bool[]> ReadCoilsAsync(ushort addr, ushort len, byte slaveId = 1)
+            => ReadBitsAsync(0x01, addr, len, slaveId, nameof(ReadCoilsAsync));
+
+        public Task<bool[]> ReadInputsAsync(ushort addr, ushort len, byte slaveId = 1)
+            => ReadBitsAsync(0x02, addr, len, slaveId, nameof(ReadInputsAsync));
+
+        public Task<ushort[]> ReadHoldingRegistersAsync(ushort addr, ushort len, byte slaveId = 1)
+            => ReadRegistersAsync(0x03, addr, len, slaveId, nameof(ReadHoldingRegistersAsync));
+
+        public Task<ushort[]> ReadInputRegistersAsync(ushort addr, ushort len, byte slaveId = 1)
+            => ReadRegistersAsync(0x04, addr, len, slaveId, nameof(ReadInputRegistersAsync));
+
+        public Task<bool> WriteSingleCoilAsync(ushort addr, bool val, byte slaveId = 1)
+            => WriteAsync(0x05, RangePdu(addr, val ? (ushort)0xFF00 : (ushort)0x0000), slaveId, nameof(WriteSingleCoilAsync));
+
+        public Task<bool> WriteSingleRegisterAsync(ushort addr, ushort val, byte slaveId = 1)
+            => WriteAsync(0x06, RangePdu(addr, val), slaveId, nameof(WriteSingleRegisterAsync));
+
+        public Task<bool> WriteMultipleCoilsAsync(ushort addr, bool[] vals, byte slaveId = 1)
+        {
+            int byteCount = (vals.Length + 7) / 8;
+            var pdu = new byte[5 + byteCount];
+            RangePdu(addr, (ushort)vals.Length).CopyTo(pdu, 0);
+            pdu[4] = (byte)byteCount;
+            for (int i = 0; i < vals.Length; i++)
+            {
+                if (vals[i])
+                    pdu[5 + (i >> 3)] |= (byte)(1 << (i & 7));
+            }
+            return WriteAsync(0x0F, pdu, slaveId, nameof(WriteMultipleCoilsAsync));
+        }
+
+        public Task<bool> WriteMultipleRegistersAsync(ushort addr, ushort[] vals, byte slaveId = 1)
+        {
+            var pdu = new byte[5 + vals.Length * 2];
+            RangePdu(addr, (ushort)vals.Length).CopyTo(pdu, 0);
+            pdu[4] = (byte)(vals.Length * 2);
+            for (int i = 0; i < vals.Length; i++)
+                BinaryPrimitives.WriteUInt16BigEndian(pdu.AsSpan(5 + i * 2), vals[i]);
+            return WriteAsync(0x10, pdu, slaveId, nameof(WriteMultipleRegistersAsync));
+        }
+
+        #endregion
+    }
+}
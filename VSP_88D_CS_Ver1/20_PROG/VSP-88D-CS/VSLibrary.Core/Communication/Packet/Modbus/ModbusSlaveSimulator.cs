@@ -0,0 +1,314 @@
+﻿using System;
+using System.Buffers.Binary;
+using VSLibrary.Communication.Packet.Checksum;
+
+namespace VSLibrary.Communication.Packet.Modbus
+{
+    /// <summary>
+    /// 메모리 내 Modbus 슬레이브 (장비 대용)
+    /// 코일/입력/홀딩/입력 레지스터 테이블을 가지고 FC 01,02,03,04,05,06,15,16 요청에 응답합니다.
+    /// ASCII(':' + HEX + LRC + CRLF) 및 RTU(+CRC16) 프레임을 모두 처리할 수 있습니다.
+    /// </summary>
+    public class ModbusSlaveSimulator
+    {
+        // Modbus 예외 코드
+        private const byte IllegalFunction = 0x01;
+        private const byte IllegalDataAddress = 0x02;
+        private const byte IllegalDataValue = 0x03;
+
+        private const byte AsciiStart = (byte)':';
+        private static ReadOnlySpan<byte> CrLf => "\r\n"u8;
+
+        // ASCII 프레임 최대 길이 (':' 와 CRLF 제외, ADU 256바이트 기준)
+        private const int MaxAsciiBodyLength = 512;
+
+        // 테이블 접근 동기화
+        private readonly object _sync = new();
+
+        /// <summary>응답할 슬레이브 주소 (0 = 브로드캐스트는 처리만 하고 응답하지 않음)</summary>
+        public byte SlaveId { get; set; }
+
+        public bool[] Coils { get; }
+        public bool[] DiscreteInputs { get; }
+        public ushort[] HoldingRegisters { get; }
+        public ushort[] InputRegisters { get; }
+
+        /// <param name="slaveId">슬레이브 주소</param>
+        /// <param name="tableSize">각 테이블의 크기 (주소 개수)</param>
+        public ModbusSlaveSimulator(byte slaveId = 1, int tableSize = 1000)
+        {
+            SlaveId = slaveId;
+            Coils = new bool[tableSize];
+            DiscreteInputs = new bool[tableSize];
+            HoldingRegisters = new ushort[tableSize];
+            InputRegisters = new ushort[tableSize];
+        }
+
+        #region 프레임 처리
+
+        /// <summary>
+        /// ASCII 프레임(':' ~ CRLF)을 처리하고 응답 프레임을 반환합니다.
+        /// LRC 오류, 다른 슬레이브 주소, 브로드캐스트인 경우 null (무응답)
+        /// </summary>
+        public byte[]? ProcessAsciiFrame(ReadOnlySpan<byte> frame)
+        {
+            if (!TryDecodeAsciiFrame(frame, out var adu))
+                return null;
+
+            var response = Process(adu);
+            return response == null ? null : EncodeAsciiFrame(response);
+        }
+
+        /// <summary>
+        /// RTU 프레임(ADU + CRC16, Little Endian)을 처리하고 응답 프레임을 반환합니다.
+        /// CRC 오류, 다른 슬레이브 주소, 브로드캐스트인 경우 null (무응답)
+        /// </summary>
+        public byte[]? ProcessRtuFrame(ReadOnlySpan<byte> frame)
+        {
+            if (frame.Length < 4)
+                return null;
+
+            var adu = frame[..^2];
+            if (BinaryPrimitives.ReadUInt16LittleEndian(frame[^2..]) != PacketChecksum.ComputeCrc16(adu))
+                return null;
+
+            var response = Process(adu);
+            if (response == null)
+                return null;
+
+            var output = new byte[response.Length + 2];
+            response.CopyTo(output, 0);
+            BinaryPrimitives.WriteUInt16LittleEndian(output.AsSpan(response.Length), PacketChecksum.ComputeCrc16(response));
+            return output;
+        }
+
+        /// <summary>
+        /// ADU(슬레이브 주소 + PDU, 체크섬 제외)를 ASCII 프레임으로 인코딩합니다.
+        /// </summary>
+        public static byte[] EncodeAsciiFrame(ReadOnlySpan<byte> adu)
+        {
+            if (adu.Length >= MaxAsciiBodyLength / 2)
+                throw new ArgumentException("ADU too long for a Modbus ASCII frame.", nameof(adu));
+
+            Span<byte> raw = stackalloc byte[adu.Length + 1];
+            adu.CopyTo(raw);
+            raw[^1] = PacketChecksum.ComputeLrc(adu);
+
+            var frame = new byte[1 + raw.Length * 2 + CrLf.Length];
+            frame[0] = AsciiStart;
+            PacketChecksum.TryEncodeHex(raw, frame.AsSpan(1, raw.Length * 2), out _);
+            frame[^2] = CrLf[0];
+            frame[^1] = CrLf[1];
+            return frame;
+        }
+
+        /// <summary>
+        /// ASCII 프레임을 ADU로 디코딩합니다. ':' 와 CRLF는 있어도 되고 없어도 됩니다.
+        /// </summary>
+        /// <returns>HEX/LRC가 올바르면 true</returns>
+        public static bool TryDecodeAsciiFrame(ReadOnlySpan<byte> frame, out byte[] adu)
+        {
+            adu = Array.Empty<byte>();
+
+            if (frame.Length > 0 && frame[0] == AsciiStart)
+                frame = frame[1..];
+            if (frame.EndsWith(CrLf))
+                frame = frame[..^CrLf.Length];
+
+            // 최소: 주소 + 기능코드 + LRC
+            if (frame.Length < 6 || frame.Length > MaxAsciiBodyLength || (frame.Length & 1) != 0)
+                return false;
+
+            Span<byte> raw = stackalloc byte[frame.Length / 2];
+            if (!PacketChecksum.TryDecodeHex(frame, raw, out _))
+                return false;
+
+            if (PacketChecksum.ComputeLrc(raw[..^1]) != raw[^1])
+                return false;
+
+            adu = raw[..^1].ToArray();
+            return true;
+        }
+
+        /// <summary>
+        /// ADU 요청을 처리하고 응답 ADU(체크섬 제외)를 반환합니다.
+        /// </summary>
+        public byte[]? Process(ReadOnlySpan<byte> adu)
+        {
+            if (adu.Length < 2)
+                return null;
+
+            byte slave = adu[0];
+            byte function = adu[1];
+            if (slave != 0 && slave != SlaveId)
+                return null;
+
+            var pdu = adu[2..];
+            byte exceptionCode;
+            byte[]? data;
+
+            lock (_sync)
+            {
+                switch (function)
+                {
+                    case 0x01: data = ReadBits(Coils, pdu, out exceptionCode); break;
+                    case 0x02: data = ReadBits(DiscreteInputs, pdu, out exceptionCode); break;
+                    case 0x03: data = ReadRegisters(HoldingRegisters, pdu, out exceptionCode); break;
+                    case 0x04: data = ReadRegisters(InputRegisters, pdu, out exceptionCode); break;
+                    case 0x05: data = WriteSingleCoil(pdu, out exceptionCode); break;
+                    case 0x06: data = WriteSingleRegister(pdu, out exceptionCode); break;
+                    case 0x0F: data = WriteMultipleCoils(pdu, out exceptionCode); break;
+                    case 0x10: data = WriteMultipleRegisters(pdu, out exceptionCode); break;
+                    default: data = null; exceptionCode = IllegalFunction; break;
+                }
+            }
+
+            // 브로드캐스트는 응답하지 않음
+            if (slave == 0)
+                return null;
+
+            if (data == null)
+                return new byte[] { slave, (byte)(function | 0x80), exceptionCode };
+
+            var response = new byte[2 + data.Length];
+            response[0] = slave;
+            response[1] = function;
+            data.CopyTo(response, 2);
+            return response;
+        }
+
+        #endregion
+
+        #region 기능코드 처리
+
+        private static bool TryReadRange(ReadOnlySpan<byte> pdu, int tableLength, int maxQuantity,
+            out int address, out int quantity, out byte exceptionCode)
+        {
+            address = quantity = 0;
+            exceptionCode = IllegalDataValue;
+            if (pdu.Length < 4)
+                return false;
+
+            address = BinaryPrimitives.ReadUInt16BigEndian(pdu);
+            quantity = BinaryPrimitives.ReadUInt16BigEndian(pdu[2..]);
+            if (quantity < 1 || quantity > maxQuantity)
+                return false;
+
+            if (address + quantity > tableLength)
+            {
+                exceptionCode = IllegalDataAddress;
+                return false;
+            }
+
+            exceptionCode = 0;
+            return true;
+        }
+
+        private static byte[]? ReadBits(bool[] table, ReadOnlySpan<byte> pdu, out byte exceptionCode)
+        {
+            if (!TryReadRange(pdu, table.Length, 2000, out int address, out int quantity, out exceptionCode))
+                return null;
+
+            int byteCount = (quantity + 7) / 8;
+            var data = new byte[1 + byteCount];
+            data[0] = (byte)byteCount;
+            for (int i = 0; i < quantity; i++)
+            {
+                if (table[address + i])
+                    data[1 + (i >> 3)] |= (byte)(1 << (i & 7));
+            }
+            return data;
+        }
+
+        private static byte[]? ReadRegisters(ushort[] table, ReadOnlySpan<byte> pdu, out byte exceptionCode)
+        {
+            if (!TryReadRange(pdu, table.Length, 125, out int address, out int quantity, out exceptionCode))
+                return null;
+
+            var data = new byte[1 + quantity * 2];
+            data[0] = (byte)(quantity * 2);
+            for (int i = 0; i < quantity; i++)
+                BinaryPrimitives.WriteUInt16BigEndian(data.AsSpan(1 + i * 2), table[address + i]);
+            return data;
+        }
+
+        private byte[]? WriteSingleCoil(ReadOnlySpan<byte> pdu, out byte exceptionCode)
+        {
+            exceptionCode = IllegalDataValue;
+            if (pdu.Length < 4)
+                return null;
+
+            int address = BinaryPrimitives.ReadUInt16BigEndian(pdu);
+            ushort value = BinaryPrimitives.ReadUInt16BigEndian(pdu[2..]);
+            if (value != 0xFF00 && value != 0x0000)
+                return null;
+
+            if (address >= Coils.Length)
+            {
+                exceptionCode = IllegalDataAddress;
+                return null;
+            }
+
+            Coils[address] = value == 0xFF00;
+            exceptionCode = 0;
+            return pdu[..4].ToArray();
+        }
+
+        private byte[]? WriteSingleRegister(ReadOnlySpan<byte> pdu, out byte exceptionCode)
+        {
+            exceptionCode = IllegalDataValue;
+            if (pdu.Length < 4)
+                return null;
+
+            int address = BinaryPrimitives.ReadUInt16BigEndian(pdu);
+            if (address >= HoldingRegisters.Length)
+            {
+                exceptionCode = IllegalDataAddress;
+                return null;
+            }
+
+            HoldingRegisters[address] = BinaryPrimitives.ReadUInt16BigEndian(pdu[2..]);
+            exceptionCode = 0;
+            return pdu[..4].ToArray();
+        }
+
+        private byte[]? WriteMultipleCoils(ReadOnlySpan<byte> pdu, out byte exceptionCode)
+        {
+            if (!TryReadRange(pdu, Coils.Length, 1968, out int address, out int quantity, out exceptionCode))
+                return null;
+
+            int byteCount = (quantity + 7) / 8;
+            if (pdu.Length < 5 || pdu[4] != byteCount || pdu.Length < 5 + byteCount)
+            {
+                exceptionCode = IllegalDataValue;
+                return null;
+            }
+
+            var values = pdu.Slice(5, byteCount);
+            for (int i = 0; i < quantity; i++)
+                Coils[address + i] = (values[i >> 3] & (1 << (i & 7))) != 0;
+
+            return pdu[..4].ToArray();
+        }
+
+        private byte[]? WriteMultipleRegisters(ReadOnlySpan<byte> pdu, out byte exceptionCode)
+        {
+            if (!TryReadRange(pdu, HoldingRegisters.Length, 123, out int address, out int quantity, out exceptionCode))
+                return null;
+
+            int byteCount = quantity * 2;
+            if (pdu.Length < 5 || pdu[4] != byteCount || pdu.Length < 5 + byteCount)
+            {
+                exceptionCode = IllegalDataValue;
+                return null;
+            }
+
+            for (int i = 0; i < quantity; i++)
+                HoldingRegisters[address + i] = BinaryPrimitives.ReadUInt16BigEndian(pdu[(5 + i * 2)..]);
+
+            return pdu[..4].ToArray();
+        }
+
+        #endregion
+    }
+}
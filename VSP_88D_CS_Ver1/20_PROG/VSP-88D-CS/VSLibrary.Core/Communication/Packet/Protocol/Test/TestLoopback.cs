@@ -0,0 +1,42 @@
+﻿using System;
+using System.Text;
+using System.Threading.Tasks;
+using VSLibrary.Communication.Loopback;
+
+namespace VSLibrary.Communication.Packet.Protocol.Test
+{
+    /// <summary>
+    /// 장비 없이 송신 데이터를 그대로 되돌려 받는 에코 채널 (CRLF 구분)
+    /// </summary>
+    public class TestLoopback : LoopbackBase
+    {
+        private const int DEFAULT_TIMEOUT = 500;
+
+        public TestLoopback(ICommunicationConfig config) : base(config)
+        {
+            _startSeq = null;
+            _delimiter = Encoding.ASCII.GetBytes("\r\n");
+        }
+
+        protected override void OnPacket(byte[] packet, bool background = true)
+        {
+            var msg = Encoding.ASCII.GetString(packet).Trim();
+            var prefix = background ? "백그라운드" : "동기";
+            EventMessage(Config.CommunicationName, CommunicationEventType.Command, $"{prefix} 패킷 처리: {msg}");
+        }
+
+        /// <summary>
+        /// 명령을 보내고 같은 내용의 에코를 기다립니다.
+        /// </summary>
+        public async Task<string?> EchoAsync(string cmd, int timeout = DEFAULT_TIMEOUT)
+        {
+            var b = Encoding.ASCII.GetBytes(cmd + "\r\n");
+            var resp = await SendReceiveAsync(b, raw => Encoding.ASCII.GetString(raw) == cmd, timeout);
+
+            if (resp == null)
+                EventMessage(Config.CommunicationName, CommunicationEventType.CommandError, $"응답 없음: {cmd}");
+
+            return resp == null ? null : Encoding.ASCII.GetString(resp);
+        }
+    }
+}
@@ -0,0 +1,68 @@
+﻿using CommunityToolkit.Mvvm.ComponentModel;
+using System.Threading.Tasks;
+using VSLibrary.Communication.Packet.Modbus;
+
+namespace VSLibrary.Communication.Packet.Protocol.Test
+{
+    public partial class TestModbusSimulatorData : ObservableObject
+    {
+        [ObservableProperty] private ushort[] holdingRegisters = [];
+        [ObservableProperty] private ushort[] inputRegisters = [];
+        [ObservableProperty] private bool[] coils = [];
+        [ObservableProperty] private bool[] inputs = [];
+    }
+
+    public class TestModbusSimulator : ModbusSimulator, IDataProvider
+    {
+        public TestModbusSimulatorData Data { get; } = new();
+        object? IDataProvider.Data => Data;
+
+        public TestModbusSimulator(ICommunicationConfig config)
+            : base(config)
+        {
+        }
+
+        public override async Task InitializeAsync()
+        {
+            await QueryAllAsync();
+        }
+
+        // ─────────────── 조회 명령 ───────────────
+
+        public async Task<bool[]> QueryCoilsAsync(ushort addr = 0, ushort len = 8, byte slaveId = 1)
+        {
+            var result = await ReadCoilsAsync(addr, len, slaveId);
+            Data.Coils = result;
+            return result;
+        }
+
+        public async Task<bool[]> QueryInputsAsync(ushort addr = 0, ushort len = 8, byte slaveId = 1)
+        {
+            var result = await ReadInputsAsync(addr, len, slaveId);
+            Data.Inputs = result;
+            return result;
+        }
+
+        public async Task<ushort[]> QueryHoldingRegistersAsync(ushort addr = 0, ushort len = 4, byte slaveId = 1)
+        {
+            var result = await ReadHoldingRegistersAsync(addr, len, slaveId);
+            Data.HoldingRegisters = result;
+            return result;
+        }
+
+        public async Task<ushort[]> QueryInputRegistersAsync(ushort addr = 0, ushort len = 4, byte slaveId = 1)
+        {
+            var result = await ReadInputRegistersAsync(addr, len, slaveId);
+            Data.InputRegisters = result;
+            return result;
+        }
+
+        public async Task QueryAllAsync(byte slaveId = 1)
+        {
+            await QueryCoilsAsync(0, 8, slaveId);
+            await QueryInputsAsync(0, 8, slaveId);
+            await QueryHoldingRegistersAsync(0, 4, slaveId);
+            await QueryInputRegistersAsync(0, 4, slaveId);
+        }
+    }
+}
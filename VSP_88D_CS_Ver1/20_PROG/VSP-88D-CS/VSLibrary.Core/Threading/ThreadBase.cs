@@ -332,13 +332,22 @@ internal static class TimeResolutionHelper
     /// <summary>
     /// Enables 1ms global timer resolution for the system.
     /// Use this to improve timing accuracy for high-precision threads.
+    /// No-op on non-Windows platforms, where WinMM does not exist.
     /// </summary>
-    public static void Enable1msResolution() => timeBeginPeriod(1);
+    public static void Enable1msResolution()
+    {
+        if (OperatingSystem.IsWindows())
+            timeBeginPeriod(1);
+    }
 
     /// <summary>
     /// Disables 1ms global timer resolution and restores the default system setting.
     /// </summary>
-    public static void Disable1msResolution() => timeEndPeriod(1);
+    public static void Disable1msResolution()
+    {
+        if (OperatingSystem.IsWindows())
+            timeEndPeriod(1);
+    }
 }
 
 /// <summary>
@@ -0,0 +1,130 @@
+﻿using System.Diagnostics;
+using System.Text;
+using VSLibrary.Communication;
+using VSLibrary.Communication.Loopback;
+using VSLibrary.Communication.Packet.Modbus;
+using VSLibrary.Communication.Packet.Protocol.Test;
+
+namespace VSLibrary.Tests.Communication;
+
+/// <summary>
+/// LoopbackBase 위에서 CommunicationBase의 프레임 분리 / SendReceiveAsync 요청-응답 매칭을 검증합니다.
+/// </summary>
+public class LoopbackTests
+{
+    private static async Task<TestLoopback> OpenEchoAsync(int chunkSize = 0, int latencyMs = 0)
+    {
+        var echo = new TestLoopback(new LoopbackConfig("Echo", CommunicationTarget.TestLoopback))
+        {
+            ChunkSize = chunkSize,
+            LatencyMs = latencyMs
+        };
+        await echo.OpenAsync();
+        return echo;
+    }
+
+    private static async Task<ModbusSimulator> OpenModbusAsync(int chunkSize = 0)
+    {
+        var modbus = new ModbusSimulator(new LoopbackConfig("Modbus", CommunicationTarget.TestModbusSimulator))
+        {
+            ChunkSize = chunkSize
+        };
+        await modbus.OpenAsync();
+        return modbus;
+    }
+
+    [Fact]
+    public async Task Echo_ReturnsSentCommand()
+    {
+        using var echo = await OpenEchoAsync();
+
+        Assert.Equal("PWR?", await echo.EchoAsync("PWR?", 1000));
+    }
+
+    [Theory]
+    [InlineData(1, 0)]
+    [InlineData(3, 0)]
+    [InlineData(3, 5)]
+    public async Task Echo_ChunkedDelivery_ReassemblesFrame(int chunkSize, int latencyMs)
+    {
+        using var echo = await OpenEchoAsync(chunkSize, latencyMs);
+
+        Assert.Equal("TMP25.5C,VLT220V", await echo.EchoAsync("TMP25.5C,VLT220V", 1000));
+        Assert.Equal("PWRON", await echo.EchoAsync("PWRON", 1000));
+    }
+
+    [Fact]
+    public async Task SendReceive_ClosedChannel_TimesOut()
+    {
+        using var echo = await OpenEchoAsync();
+        await echo.CloseAsync();
+
+        Assert.Null(await echo.SendReceiveAsync(Encoding.ASCII.GetBytes("PWR?\r\n"), _ => true, 50));
+    }
+
+    [Fact]
+    public async Task ConnectedPeers_DeliverToEachOther()
+    {
+        using var a = await OpenEchoAsync();
+        using var b = await OpenEchoAsync();
+        a.Connect(b);
+
+        var received = new List<string>();
+        b.CommunicationEvent += (_, e) =>
+        {
+            if (e.EventType == CommunicationEventType.Rx)
+                received.Add(e.Message);
+        };
+
+        await a.SendAsync(Encoding.ASCII.GetBytes("HELLO\r\n"));
+
+        Assert.Contains("HELLO", Assert.Single(received));
+    }
+
+    [Theory]
+    [InlineData(0)]
+    [InlineData(4)]
+    public async Task Modbus_ReadHoldingRegisters(int chunkSize)
+    {
+        using var modbus = await OpenModbusAsync(chunkSize);
+        modbus.Slave.HoldingRegisters[2] = 0x1234;
+        modbus.Slave.HoldingRegisters[3] = 0xABCD;
+
+        Assert.Equal(new ushort[] { 0x1234, 0xABCD }, await modbus.ReadHoldingRegistersAsync(2, 2));
+    }
+
+    [Fact]
+    public async Task Modbus_WriteMultipleCoils_ThenReadCoils()
+    {
+        using var modbus = await OpenModbusAsync();
+        var coils = new[] { true, false, true, true, false, false, true, true, true, false };
+
+        Assert.True(await modbus.WriteMultipleCoilsAsync(20, coils));
+        Assert.Equal(coils, await modbus.ReadCoilsAsync(20, (ushort)coils.Length));
+    }
+
+    [Fact]
+    public async Task Modbus_SlaveException_ReturnsNullAndRaisesEvent()
+    {
+        using var modbus = await OpenModbusAsync();
+        var events = new List<CommunicationEventType>();
+        modbus.CommunicationEvent += (_, e) => events.Add(e.EventType);
+
+        Assert.Null(await modbus.ReadHoldingRegistersAsync(999, 2));
+        Assert.Contains(CommunicationEventType.SlaveEx, events);
+    }
+
+    [Fact]
+    public async Task Modbus_Broadcast_CompletesWithoutWaitingForTimeout()
+    {
+        using var modbus = await OpenModbusAsync();
+        modbus.ReadTimeout = 5000;
+
+        var sw = Stopwatch.StartNew();
+        Assert.True(await modbus.WriteSingleRegisterAsync(5, 77, slaveId: 0));
+        sw.Stop();
+
+        Assert.True(sw.ElapsedMilliseconds < 1000, $"broadcast took {sw.ElapsedMilliseconds} ms");
+        Assert.Equal((ushort)77, modbus.Slave.HoldingRegisters[5]);
+    }
+}
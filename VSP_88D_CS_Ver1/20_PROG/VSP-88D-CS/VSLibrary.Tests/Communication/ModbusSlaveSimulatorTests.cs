@@ -0,0 +1,94 @@
+﻿using System.Text;
+using VSLibrary.Communication.Packet.Checksum;
+using VSLibrary.Communication.Packet.Modbus;
+
+namespace VSLibrary.Tests.Communication;
+
+/// <summary>
+/// Modbus 규격서 예제 프레임으로 가상 슬레이브 응답을 검증합니다.
+/// </summary>
+public class ModbusSlaveSimulatorTests
+{
+    private static byte[] Hex(string hex) => Convert.FromHexString(hex);
+
+    [Fact]
+    public void Ascii_ReadHoldingRegister()
+    {
+        var slave = new ModbusSlaveSimulator();
+        slave.HoldingRegisters[2] = 0x1234;
+
+        var response = slave.ProcessAsciiFrame(Encoding.ASCII.GetBytes(":010300020001F9\r\n"));
+
+        Assert.NotNull(response);
+        Assert.Equal(":0103021234B4\r\n", Encoding.ASCII.GetString(response));
+    }
+
+    [Fact]
+    public void Rtu_ReadHoldingRegister()
+    {
+        var slave = new ModbusSlaveSimulator();
+        slave.HoldingRegisters[2] = 0x1234;
+
+        var response = slave.ProcessRtuFrame(Hex("01030002000125CA"));
+
+        Assert.Equal(Hex("0103021234B533"), response);
+    }
+
+    [Fact]
+    public void Exception_IllegalDataAddress()
+    {
+        var slave = new ModbusSlaveSimulator(tableSize: 10);
+
+        var response = slave.Process(Hex("010300090002"));
+
+        Assert.NotNull(response);
+        Assert.Equal(Hex("018302"), response);
+        Assert.Equal(":0183027A\r\n", Encoding.ASCII.GetString(ModbusSlaveSimulator.EncodeAsciiFrame(response)));
+        Assert.Equal(Hex("018302C0F1"), slave.ProcessRtuFrame(WithCrc(Hex("010300090002"))));
+    }
+
+    [Fact]
+    public void Exception_IllegalFunction()
+    {
+        var slave = new ModbusSlaveSimulator();
+
+        Assert.Equal(Hex("018701"), slave.Process(Hex("0107")));
+    }
+
+    [Fact]
+    public void WriteMultipleCoils_ThenReadCoils()
+    {
+        var slave = new ModbusSlaveSimulator();
+
+        // 규격서 예제: 코일 20~29 에 CD 01 기록
+        Assert.Equal(Hex("010F0013000A"), slave.Process(Hex("010F0013000A02CD01")));
+        Assert.Equal(Hex("010102CD01"), slave.Process(Hex("01010013000A")));
+        Assert.True(slave.Coils[19]);
+        Assert.False(slave.Coils[20]);
+    }
+
+    [Fact]
+    public void Broadcast_AppliesWithoutResponse()
+    {
+        var slave = new ModbusSlaveSimulator();
+
+        Assert.Null(slave.Process(Hex("000600010003")));
+        Assert.Equal((ushort)3, slave.HoldingRegisters[1]);
+    }
+
+    [Fact]
+    public void OtherSlaveOrBadChecksum_NoResponse()
+    {
+        var slave = new ModbusSlaveSimulator();
+
+        Assert.Null(slave.Process(Hex("020300000001")));
+        Assert.Null(slave.ProcessAsciiFrame(Encoding.ASCII.GetBytes(":010300020001F8\r\n")));
+        Assert.Null(slave.ProcessRtuFrame(Hex("01030002000125CB")));
+    }
+
+    private static byte[] WithCrc(byte[] adu)
+    {
+        ushort crc = PacketChecksum.ComputeCrc16(adu);
+        return [.. adu, (byte)crc, (byte)(crc >> 8)];
+    }
+}
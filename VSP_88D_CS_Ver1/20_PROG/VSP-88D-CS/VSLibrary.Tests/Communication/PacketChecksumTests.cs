@@ -0,0 +1,282 @@
+﻿using System.Buffers;
+using System.Text;
+using VSLibrary.Communication.Packet.Checksum;
+using System.Runtime.Intrinsics.X86;
+using ArmCrc32 = System.Runtime.Intrinsics.Arm.Crc32;
+
+namespace VSLibrary.Tests.Communication;
+
+/// <summary>
+/// PacketChecksum 골든 벡터와 기존 비트 루프 구현과의 일치 검사.
+/// 길이는 HEX 벡터 경로(인코딩 16바이트, 디코딩 32문자 블록)와 Slicing-by-8 경계 전후를 모두 지나도록 고릅니다.
+/// </summary>
+public class PacketChecksumTests
+{
+    private static readonly byte[] CheckInput = "123456789"u8.ToArray();
+
+    public static TheoryData<int> Lengths => new() { 0, 1, 7, 8, 9, 15, 16, 17, 31, 32, 33, 47, 48, 63, 64, 65, 79, 80, 127, 128, 129, 255, 256, 1000 };
+
+    private static byte[] RandomBytes(int length)
+    {
+        var data = new byte[length];
+        new Random(length).NextBytes(data);
+        return data;
+    }
+
+    #region CRC / LRC
+
+    [Fact]
+    public void Crc16_CheckValue()
+    {
+        Assert.Equal(0x4B37, PacketChecksum.ComputeCrc16(CheckInput));
+    }
+
+    [Fact]
+    public void Crc32_CheckValue()
+    {
+        Assert.Equal(0xCBF43926u, PacketChecksum.ComputeCrc32(CheckInput));
+    }
+
+    [Theory]
+    [MemberData(nameof(Lengths))]
+    public void Crc16_MatchesBitwise(int length)
+    {
+        var data = RandomBytes(length);
+        Assert.Equal(BitwiseCrc16(data), PacketChecksum.ComputeCrc16(data));
+    }
+
+    [Theory]
+    [MemberData(nameof(Lengths))]
+    public void Crc32_MatchesBitwise(int length)
+    {
+        var data = RandomBytes(length);
+        uint expected = BitwiseCrc32(data);
+
+        Assert.Equal(expected, PacketChecksum.ComputeCrc32(data));
+        Assert.Equal(expected, ~PacketChecksum.UpdateCrc32Table(PacketChecksum.Crc32Seed, data));
+    }
+
+    /// <summary>
+    /// 하드웨어 경로를 테이블 경로와 비교합니다. 현재 CPU가 해당 명령을 지원하지 않으면 Skipped 로 표시됩니다.
+    /// 시드는 초기값과 스트리밍 도중 값(임의)을 모두 사용합니다.
+    /// </summary>
+    [HardwareTheory(HardwareFeature.Arm64Crc32)]
+    [MemberData(nameof(Lengths))]
+    public void Crc32_Arm64_MatchesTable(int length)
+    {
+        var data = RandomBytes(length);
+        foreach (uint seed in new[] { PacketChecksum.Crc32Seed, 0x1234_5678u })
+        {
+            Assert.Equal(
+                PacketChecksum.UpdateCrc32Table(seed, data),
+                PacketChecksum.UpdateCrc32Arm64(seed, data));
+        }
+    }
+
+    [HardwareTheory(HardwareFeature.Pclmulqdq)]
+    [MemberData(nameof(Lengths))]
+    public void Crc32_Pclmul_MatchesTable(int length)
+    {
+        var data = RandomBytes(length);
+        foreach (uint seed in new[] { PacketChecksum.Crc32Seed, 0x1234_5678u })
+        {
+            Assert.Equal(
+                PacketChecksum.UpdateCrc32Table(seed, data),
+                PacketChecksum.UpdateCrc32Pclmul(seed, data));
+        }
+    }
+
+    [Theory]
+    [MemberData(nameof(Lengths))]
+    public void Lrc_MatchesLegacy(int length)
+    {
+        var data = RandomBytes(length);
+        Assert.Equal(LegacyLrc(data), PacketChecksum.ComputeLrc(data));
+    }
+
+    [Fact]
+    public void UpdateCrc16_SplitStreaming()
+    {
+        var data = RandomBytes(100);
+        ushort expected = PacketChecksum.ComputeCrc16(data);
+
+        for (int split = 0; split <= data.Length; split++)
+        {
+            ushort crc = PacketChecksum.UpdateCrc16(PacketChecksum.Crc16Seed, data.AsSpan(0, split));
+            crc = PacketChecksum.UpdateCrc16(crc, data.AsSpan(split));
+            Assert.Equal(expected, crc);
+        }
+    }
+
+    [Fact]
+    public void UpdateCrc32_SplitStreaming()
+    {
+        var data = RandomBytes(100);
+        uint expected = PacketChecksum.ComputeCrc32(data);
+
+        for (int split = 0; split <= data.Length; split++)
+        {
+            uint crc = PacketChecksum.UpdateCrc32(PacketChecksum.Crc32Seed, data.AsSpan(0, split));
+            crc = PacketChecksum.UpdateCrc32(crc, data.AsSpan(split));
+            Assert.Equal(expected, ~crc);
+        }
+    }
+
+    [Fact]
+    public void Sequence_MultiSegment_MatchesSingleSpan()
+    {
+        var data = RandomBytes(100);
+        var sequence = CreateSequence(data, 1, 7, 16, 3, 50, 23);
+
+        Assert.False(sequence.IsSingleSegment);
+        Assert.Equal(PacketChecksum.ComputeCrc16(data), PacketChecksum.ComputeCrc16(sequence));
+        Assert.Equal(PacketChecksum.ComputeCrc32(data), PacketChecksum.ComputeCrc32(sequence));
+    }
+
+    #endregion
+
+    #region HEX
+
+    [Theory]
+    [MemberData(nameof(Lengths))]
+    public void Hex_RoundTrip(int length)
+    {
+        var data = RandomBytes(length);
+        var hex = new byte[length * 2];
+
+        Assert.True(PacketChecksum.TryEncodeHex(data, hex, out int written));
+        Assert.Equal(hex.Length, written);
+        Assert.Equal(Convert.ToHexString(data), Encoding.ASCII.GetString(hex));
+
+        var decoded = new byte[length];
+        Assert.True(PacketChecksum.TryDecodeHex(hex, decoded, out written));
+        Assert.Equal(length, written);
+        Assert.Equal(data, decoded);
+
+        var lower = Encoding.ASCII.GetBytes(Convert.ToHexString(data).ToLowerInvariant());
+        Array.Clear(decoded);
+        Assert.True(PacketChecksum.TryDecodeHex(lower, decoded, out written));
+        Assert.Equal(length, written);
+        Assert.Equal(data, decoded);
+    }
+
+    /// <summary>
+    /// '0'-'9', 'A'-'F', 'a'-'f' 바로 앞뒤 문자는 블록 앞/끝, 벡터 블록 뒤 나머지 어디에 있어도 거부해야 합니다.
+    /// </summary>
+    [Theory]
+    [InlineData('/')]
+    [InlineData(':')]
+    [InlineData('@')]
+    [InlineData('G')]
+    [InlineData('`')]
+    [InlineData('g')]
+    public void Hex_RejectsCharactersOutsideDigitRanges(char invalid)
+    {
+        var valid = Encoding.ASCII.GetBytes(Convert.ToHexString(RandomBytes(40)));
+        var destination = new byte[valid.Length / 2];
+
+        foreach (int position in new[] { 0, 1, 15, 16, 31, 32, 33, 63, 64, 79 })
+        {
+            var hex = (byte[])valid.Clone();
+            hex[position] = (byte)invalid;
+            Assert.False(PacketChecksum.TryDecodeHex(hex, destination, out _), $"'{invalid}' at {position}");
+        }
+    }
+
+    [Fact]
+    public void Hex_RejectsOddLengthAndShortDestination()
+    {
+        Assert.False(PacketChecksum.TryDecodeHex("ABC"u8, new byte[2], out _));
+        Assert.False(PacketChecksum.TryDecodeHex("ABCD"u8, new byte[1], out _));
+        Assert.False(PacketChecksum.TryEncodeHex(new byte[2], new byte[3], out _));
+    }
+
+    #endregion
+
+    #region 기준 구현
+
+    private static ushort BitwiseCrc16(ReadOnlySpan<byte> data)
+    {
+        ushort crc = 0xFFFF;
+        foreach (byte b in data)
+        {
+            crc ^= b;
+            for (int j = 0; j < 8; j++)
+                crc = (ushort)((crc & 1) != 0 ? (crc >> 1) ^ 0xA001 : crc >> 1);
+        }
+        return crc;
+    }
+
+    private static uint BitwiseCrc32(ReadOnlySpan<byte> data)
+    {
+        uint crc = 0xFFFFFFFF;
+        foreach (byte b in data)
+        {
+            crc ^= b;
+            for (int j = 0; j < 8; j++)
+                crc = (crc & 1) != 0 ? (crc >> 1) ^ 0xEDB88320 : crc >> 1;
+        }
+        return ~crc;
+    }
+
+    // 기존 PacketHelper.ComputeLrc 계산식
+    private static byte LegacyLrc(ReadOnlySpan<byte> data)
+    {
+        byte sum = 0;
+        foreach (byte b in data)
+            unchecked { sum += b; }
+        return (byte)((sum ^ 0xFF) + 1);
+    }
+
+    private sealed class Segment : ReadOnlySequenceSegment<byte>
+    {
+        public Segment(ReadOnlyMemory<byte> memory, Segment? previous)
+        {
+            Memory = memory;
+            if (previous != null)
+            {
+                RunningIndex = previous.RunningIndex + previous.Memory.Length;
+                previous.Next = this;
+            }
+        }
+    }
+
+    private static ReadOnlySequence<byte> CreateSequence(byte[] data, params int[] sizes)
+    {
+        Segment? first = null, last = null;
+        int offset = 0;
+        foreach (int size in sizes)
+        {
+            last = new Segment(data.AsMemory(offset, size), last);
+            first ??= last;
+            offset += size;
+        }
+        return new ReadOnlySequence<byte>(first!, 0, last!, last!.Memory.Length);
+    }
+
+    #endregion
+
+    public enum HardwareFeature
+    {
+        Arm64Crc32,
+        Pclmulqdq
+    }
+
+    /// <summary>
+    /// 지원하지 않는 CPU에서는 통과가 아니라 Skipped 로 보고되는 Theory
+    /// </summary>
+    public sealed class HardwareTheoryAttribute : TheoryAttribute
+    {
+        public HardwareTheoryAttribute(HardwareFeature feature)
+        {
+            bool supported = feature switch
+            {
+                HardwareFeature.Arm64Crc32 => ArmCrc32.Arm64.IsSupported,
+                HardwareFeature.Pclmulqdq => Pclmulqdq.IsSupported,
+                _ => false
+            };
+            if (!supported)
+                Skip = $"{feature} is not supported on this CPU.";
+        }
+    }
+}
@@ -0,0 +1,81 @@
+﻿using VSLibrary.Controller;
+using VSLibrary.Controller.DigitalIO;
+
+namespace VSLibrary.Tests.Controller;
+
+/// <summary>
+/// SimulatedDIO 접점 이름 / 모듈 워드 / 비트 오프셋 매핑 검증 (Windows 전용: Controller 계층이 WPF에 의존)
+/// </summary>
+public class SimulatedDIOTests
+{
+    private readonly Dictionary<string, int> _count = new() { { "DInput", 0 }, { "DOutput", 0 } };
+    private readonly SimulatedDIO _dio;
+    private readonly Dictionary<string, IDigitalIOData> _points;
+
+    public SimulatedDIOTests()
+    {
+        _dio = new SimulatedDIO(_count, new SimulatedControllerConfig { DigitalInputCount = 40, DigitalOutputCount = 40 });
+        _points = _dio.GetDigitalIODataDictionary();
+    }
+
+    [Fact]
+    public void Points_MapToModuleWordAndOffset()
+    {
+        Assert.Equal(80, _points.Count);
+        Assert.Equal(40, _count["DInput"]);
+        Assert.Equal(40, _count["DOutput"]);
+
+        Assert.Equal((0, 31), (_points["X01F"].ModuleIndex, _points["X01F"].Offset));
+        Assert.Equal((1, 0), (_points["X020"].ModuleIndex, _points["X020"].Offset));
+        Assert.Equal((1, 7), (_points["Y027"].ModuleIndex, _points["Y027"].Offset));
+        Assert.Equal(IOType.InPut, _points["X000"].IOType);
+        Assert.Equal(IOType.OUTPut, _points["Y000"].IOType);
+    }
+
+    [Fact]
+    public void SetInput_IsVisibleThroughReadBitAndUpdate()
+    {
+        _dio.SetInput(33, true);
+
+        Assert.True(_dio.ReadBit(_points["X021"]));
+        Assert.False(_dio.ReadBit(_points["X020"]));
+        Assert.False(_dio.ReadBit(_points["X001"]));
+
+        _dio.SetInput(33, false);
+        _dio.SetInput(1, true);
+        _dio.UpdateAllIOStates();
+
+        Assert.False(_points["X021"].Value);
+        Assert.True(_points["X001"].Value);
+    }
+
+    [Fact]
+    public void WriteDword_SetsBitsOfThatModuleOnly()
+    {
+        _dio.WriteDword(_points, "Y000", 0x80000001);
+
+        Assert.True(_points["Y000"].Value);
+        Assert.False(_points["Y001"].Value);
+        Assert.True(_points["Y01F"].Value);
+        Assert.False(_dio.ReadBit(_points["Y020"]));
+    }
+
+    [Fact]
+    public void WriteBit_IsVisibleThroughReadDword()
+    {
+        _dio.WriteBit(_points["Y021"], true);
+        _points["Y021"].Value = false;
+
+        _dio.ReadDword(_points, "Y020");
+
+        Assert.True(_points["Y021"].Value);
+        Assert.False(_points["Y020"].Value);
+    }
+
+    [Fact]
+    public void WritesToInputs_Throw()
+    {
+        Assert.Throws<InvalidOperationException>(() => _dio.WriteBit(_points["X000"], true));
+        Assert.Throws<InvalidOperationException>(() => _dio.WriteDword(_points, "X000", 1));
+    }
+}
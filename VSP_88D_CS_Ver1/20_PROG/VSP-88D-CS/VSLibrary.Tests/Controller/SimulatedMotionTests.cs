@@ -0,0 +1,153 @@
+﻿using VSLibrary.Controller;
+using VSLibrary.Controller.Motion;
+
+namespace VSLibrary.Tests.Controller;
+
+/// <summary>
+/// SimulatedMotion 등속 위치 프로파일 / 정지 / 서보·알람 인터락 검증 (Windows 전용: Controller 계층이 WPF에 의존)
+/// </summary>
+public class SimulatedMotionTests
+{
+    private const int Axis = 0;
+
+    private readonly SimulatedMotion _motion = new(new Dictionary<string, int>(), new SimulatedControllerConfig { AxisCount = 2 });
+
+    private async Task WaitStoppedAsync(int timeoutMs = 2000)
+    {
+        var until = DateTime.UtcNow.AddMilliseconds(timeoutMs);
+        while (_motion.IsMoving(Axis) && DateTime.UtcNow < until)
+            await Task.Delay(5);
+        Assert.False(_motion.IsMoving(Axis));
+    }
+
+    [Fact]
+    public async Task MoveToPoint_AdvancesWithTimeAndReachesTarget()
+    {
+        _motion.SetServoOnOff(Axis, true);
+
+        // 100/s 로 1000 이동: 100ms 후 약 10 (스케줄링 여유를 두고 범위로 검사)
+        _motion.MoveToPoint(Axis, 1000, 100, 0);
+        await Task.Delay(100);
+
+        Assert.True(_motion.IsMoving(Axis));
+        Assert.InRange(_motion.GetPosition(Axis), 1.0, 500.0);
+        Assert.Equal(1000, _motion.GetCmdPosition(Axis));
+
+        _motion.MoveToPoint(Axis, 5, 1000, 0);
+        await WaitStoppedAsync();
+
+        Assert.Equal(5, _motion.GetPosition(Axis));
+    }
+
+    [Fact]
+    public async Task MoveToPosition_IsRelative()
+    {
+        _motion.SetServoOnOff(Axis, true);
+
+        _motion.MoveToPoint(Axis, 5, 1000, 0);
+        await WaitStoppedAsync();
+        _motion.MoveToPosition(Axis, 3, 1000, 0);
+        await WaitStoppedAsync();
+
+        Assert.Equal(8, _motion.GetPosition(Axis));
+    }
+
+    [Fact]
+    public async Task StopMotion_FreezesPosition()
+    {
+        _motion.SetServoOnOff(Axis, true);
+        _motion.MoveToPoint(Axis, 1000, 100, 0);
+        await Task.Delay(50);
+
+        Assert.True(_motion.StopMotion(Axis));
+        double stopped = _motion.GetPosition(Axis);
+        await Task.Delay(50);
+
+        Assert.False(_motion.IsMoving(Axis));
+        Assert.Equal(stopped, _motion.GetPosition(Axis));
+        Assert.Equal(stopped, _motion.GetCmdPosition(Axis));
+        Assert.InRange(stopped, 0.0, 500.0);
+    }
+
+    [Fact]
+    public async Task Moves_AreIgnoredWhileServoOffOrAlarmed()
+    {
+        _motion.MoveToPoint(Axis, 100, 1000, 0);
+        _motion.MoveToPosition(Axis, 100, 1000, 0);
+        _motion.Repeat(Axis, new double[] { 10, 20 }, 1000, 0, 2);
+        await _motion.HomeMove(Axis, default);
+
+        Assert.False(_motion.IsMoving(Axis));
+        Assert.Equal(0, _motion.GetCmdPosition(Axis));
+        Assert.False(_motion.IsHomed(Axis));
+
+        _motion.SetServoOnOff(Axis, true);
+        _motion.SetAlarm(Axis, true);
+        _motion.MoveToPoint(Axis, 100, 1000, 0);
+
+        Assert.False(_motion.IsMoving(Axis));
+        Assert.Equal(0, _motion.GetCmdPosition(Axis));
+
+        await _motion.ClearAlarm(Axis);
+        _motion.MoveToPoint(Axis, 10, 1000, 0);
+        await WaitStoppedAsync();
+
+        Assert.Equal(10, _motion.GetPosition(Axis));
+    }
+
+    [Theory]
+    [InlineData("servo")]
+    [InlineData("output")]
+    [InlineData("alarm")]
+    public async Task RunningMove_HaltsOnServoOffOrAlarm(string cause)
+    {
+        _motion.SetServoOnOff(Axis, true);
+        await _motion.HomeMove(Axis, default);
+        _motion.MoveToPoint(Axis, 1000, 100, 0);
+        await Task.Delay(50);
+
+        switch (cause)
+        {
+            case "servo": _motion.SetServoOnOff(Axis, false); break;
+            case "output": _motion.SetOutput(Axis, 0, false); break;
+            default: _motion.SetAlarm(Axis, true); break;
+        }
+        double halted = _motion.GetPosition(Axis);
+        await Task.Delay(50);
+
+        Assert.False(_motion.IsMoving(Axis));
+        Assert.Equal(halted, _motion.GetPosition(Axis));
+        Assert.Equal(halted, _motion.GetCmdPosition(Axis));
+        Assert.Equal(cause == "alarm", _motion.IsHomed(Axis));
+        Assert.Equal(cause == "alarm", _motion.IsServo(Axis));
+    }
+
+    [Fact]
+    public async Task HomeMove_SupersedesRunningRepeat()
+    {
+        _motion.SetServoOnOff(Axis, true);
+        _motion.Repeat(Axis, new double[] { 1000, 0 }, 100, 0, 1);
+        await Task.Delay(20);
+
+        // 이전 Repeat 태스크가 끝나면서 HomeMove를 취소하거나 다음 위치로 이동시키면 안 됨
+        await _motion.HomeMove(Axis, default);
+        await Task.Delay(50);
+
+        Assert.True(_motion.IsHomed(Axis));
+        Assert.False(_motion.IsMoving(Axis));
+        Assert.Equal(0, _motion.GetPosition(Axis));
+    }
+
+    [Fact]
+    public async Task HomeMove_ReturnsToZeroAndMarksHomed()
+    {
+        _motion.SetServoOnOff(Axis, true);
+        _motion.MoveToPoint(Axis, 1, 1000, 0);
+        await WaitStoppedAsync();
+
+        await _motion.HomeMove(Axis, default);
+
+        Assert.Equal(0, _motion.GetPosition(Axis));
+        Assert.True(_motion.IsHomed(Axis));
+    }
+}
@@ -73,6 +73,14 @@ namespace VSLibrary.Communication
                         comm = new YoungshinRFGenerator(cfg);
                         break;
 
+                    case CommunicationTarget.TestLoopback:
+                        comm = new TestLoopback(cfg);
+                        break;
+
+                    case CommunicationTarget.TestModbusSimulator:
+                        comm = new TestModbusSimulator(cfg);
+                        break;
+
                     default:
                         // 지원하지 않는 Target은 건너뛴다
                         continue;
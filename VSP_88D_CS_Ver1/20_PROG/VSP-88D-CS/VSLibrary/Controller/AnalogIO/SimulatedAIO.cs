@@ -0,0 +1,147 @@
+using System;
+using System.Collections.Generic;
+using System.Linq;
+
+namespace VSLibrary.Controller.AnalogIO
+{
+    /// <summary>
+    /// Headless analog I/O controller that keeps channel values in memory.
+    /// Lets sequences, UI and benchmarks run without an Ajin/Adlink board;
+    /// each driver call can be delayed via <see cref="SimulatedControllerConfig.LatencyMs"/>.
+    /// </summary>
+    public class SimulatedAIO : AIOBase
+    {
+        /// <summary>
+        /// Dictionary storing analog I/O data objects keyed by wire name.
+        /// </summary>
+        private Dictionary<string, IAnalogIOData> _analogIOData = new Dictionary<string, IAnalogIOData>();
+
+        private Dictionary<string, int> _iocount;
+
+        private readonly SimulatedControllerConfig _config;
+
+        /// <summary>
+        /// Simulated board registers (index = channel).
+        /// </summary>
+        private readonly double[] _inputs;
+        private readonly double[] _outputs;
+
+        /// <summary>
+        /// Constructs the simulated analog I/O controller and creates its channels.
+        /// </summary>
+        /// <param name="count">Dictionary containing channel counts (e.g., "AInput", "AOutput").</param>
+        /// <param name="config">Channel counts and per-call latency.</param>
+        public SimulatedAIO(Dictionary<string, int> count, SimulatedControllerConfig config)
+        {
+            _iocount = count;
+            _config = config ?? new SimulatedControllerConfig();
+
+            _inputs = new double[_config.AnalogInputCount];
+            _outputs = new double[_config.AnalogOutputCount];
+
+            OpenDevice();
+        }
+
+        /// <summary>
+        /// Creates input (AI) and output (AO) channel entries and updates _iocount.
+        /// </summary>
+        public void OpenDevice()
+        {
+            for (int i = 0; i < _inputs.Length; i++)
+            {
+                AIOData data = new AIOData
+                {
+                    Controller = this,
+                    ControllerType = ControllerType.AIO_Simulated,
+                    IOType = IOType.InPut,
+                    WireName = $"AI{i + _iocount["AInput"]:X3}",  // e.g.: AI000, AI001
+                    StrdataName = string.Empty,
+                    ModuleName = "SIM_AI",
+                    ModuleNumber = 0,
+                    Channel = i,
+                    Range = 0
+                };
+                _analogIOData.Add(data.WireName, data);
+            }
+            _iocount["AInput"] += _inputs.Length;
+
+            for (int i = 0; i < _outputs.Length; i++)
+            {
+                AIOData data = new AIOData
+                {
+                    Controller = this,
+                    ControllerType = ControllerType.AIO_Simulated,
+                    IOType = IOType.OUTPut,
+                    WireName = $"AO{i + _iocount["AOutput"]:X3}",  // e.g.: AO000, AO001
+                    StrdataName = string.Empty,
+                    ModuleName = "SIM_AO",
+                    ModuleNumber = 0,
+                    Channel = i,
+                    Range = 0
+                };
+                _analogIOData.Add(data.WireName, data);
+            }
+            _iocount["AOutput"] += _outputs.Length;
+        }
+
+        /// <summary>
+        /// Returns the dictionary of analog I/O data objects.
+        /// </summary>
+        public override Dictionary<string, IAnalogIOData> GetAnalogIODataDictionary()
+        {
+            return _analogIOData.ToDictionary(kvp => kvp.Key, kvp => kvp.Value);
+        }
+
+        /// <summary>
+        /// Forces the value seen on a simulated input channel (e.g., sensor voltage).
+        /// </summary>
+        /// <param name="channel">Input channel index.</param>
+        /// <param name="value">Value to present on the channel.</param>
+        public void SetInputValue(int channel, double value)
+        {
+            _inputs[channel] = value;
+        }
+
+        /// <summary>
+        /// Reads the current value of the specified channel.
+        /// </summary>
+        public override double ReadChannelValue(IAnalogIOData aioData)
+        {
+            _config.WaitLatency();
+
+            return aioData.IOType == IOType.InPut
+                ? _inputs[aioData.Channel]
+                : _outputs[aioData.Channel];
+        }
+
+        /// <summary>
+        /// Writes a value to the specified output channel.
+        /// </summary>
+        /// <returns>True if written; false for input channels.</returns>
+        public override bool WriteChannelValue(IAnalogIOData aioData, double value)
+        {
+            if (aioData.IOType != IOType.OUTPut)
+                return false;
+
+            _config.WaitLatency();
+            _outputs[aioData.Channel] = value;
+            return true;
+        }
+
+        /// <summary>
+        /// Refreshes every channel's value from the simulated registers.
+        /// Costs one latency period, like a bulk board read.
+        /// </summary>
+        public override void UpdateAllChannelValues()
+        {
+            _config.WaitLatency();
+
+            foreach (var data in _analogIOData.Values)
+            {
+                data.AValue = data.IOType == IOType.InPut
+                    ? _inputs[data.Channel]
+                    : _outputs[data.Channel];
+            }
+        }
+    }
+}
@@ -1,6 +1,7 @@
 ﻿using System;
 using System.Collections.Generic;
 using System.ComponentModel.DataAnnotations.Schema;
+using System.Diagnostics;
 using System.Linq;
 using System.Text;
 using System.Threading.Tasks;
@@ -385,4 +386,34 @@ namespace VSLibrary.Controller
 
         public bool _stopRequested = false; // 정지 요청 플래그        
     }
+
+    /// <summary>
+    /// 시뮬레이션 컨트롤러(AIO/DIO/Motion_Simulated) 설정입니다.
+    /// 보드 없이 시퀀스 검증이나 성능 측정을 할 때 채널 수와 드라이버 호출 지연을 지정합니다.
+    /// </summary>
+    public class SimulatedControllerConfig
+    {
+        public int AnalogInputCount { get; set; } = 8;   // AI 채널 수
+        public int AnalogOutputCount { get; set; } = 8;  // AO 채널 수
+        public int DigitalInputCount { get; set; } = 32;  // X 접점 수
+        public int DigitalOutputCount { get; set; } = 32; // Y 접점 수
+        public int AxisCount { get; set; } = 4;          // 축 수
+
+        // 드라이버 호출 1회당 지연 (ms, 0이면 지연 없음)
+        public double LatencyMs { get; set; } = 0;
+
+        /// <summary>
+        /// 드라이버 호출 지연을 흉내냅니다.
+        /// Thread.Sleep 해상도(1~15ms)보다 짧은 지연도 재현하도록 스핀 대기합니다.
+        /// </summary>
+        public void WaitLatency()
+        {
+            if (LatencyMs <= 0) return;
+
+            long until = Stopwatch.GetTimestamp() + (long)(LatencyMs * Stopwatch.Frequency / 1000.0);
+            var spinner = new SpinWait();
+            while (Stopwatch.GetTimestamp() < until)
+                spinner.SpinOnce(-1);
+        }
+    }
 }
@@ -60,6 +60,21 @@ namespace VSLibrary.Controller
         /// <summary>
         /// Comizoa motion controller.
         /// </summary>
-        Motion_Comizoa
+        Motion_Comizoa,
+
+        /// <summary>
+        /// Simulated analog I/O controller (no hardware required).
+        /// </summary>
+        AIO_Simulated,
+
+        /// <summary>
+        /// Simulated digital I/O controller (no hardware required).
+        /// </summary>
+        DIO_Simulated,
+
+        /// <summary>
+        /// Simulated motion controller (no hardware required).
+        /// </summary>
+        Motion_Simulated
     }
 }
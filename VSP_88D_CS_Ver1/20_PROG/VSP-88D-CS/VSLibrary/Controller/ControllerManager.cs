@@ -37,8 +37,11 @@ namespace VSLibrary.Controller
         /// </summary>
         /// <param name="container">Dependency injection container for registering instances.</param>
         /// <param name="Controllerlist">List of controller types to initialize.</param>
-        public ControllerManager(IContainer container, List<ControllerType> Controllerlist)
+        /// <param name="simulatedConfig">Channel counts and latency for the *_Simulated controller types (defaults if null).</param>
+        public ControllerManager(IContainer container, List<ControllerType> Controllerlist, SimulatedControllerConfig? simulatedConfig = null)
         {
+            simulatedConfig ??= new SimulatedControllerConfig();
+
             foreach (var controllerType in Controllerlist)
             {
                 // Initialize AXT library if any Ajin AXT controllers are requested
@@ -104,6 +107,33 @@ namespace VSLibrary.Controller
                         }
 
                         break;
+
+                    case ControllerType.AIO_Simulated:
+                        var simAIOCtrl = new SimulatedAIO(count, simulatedConfig);
+
+                        foreach (var data in simAIOCtrl.GetAnalogIODataDictionary())
+                        {
+                            AIOData[data.Key] = data.Value;
+                        }
+                        break;
+
+                    case ControllerType.DIO_Simulated:
+                        var simDIOCtrl = new SimulatedDIO(count, simulatedConfig);
+
+                        foreach (var data in simDIOCtrl.GetDigitalIODataDictionary())
+                        {
+                            DIOData[data.Key] = data.Value;
+                        }
+                        break;
+
+                    case ControllerType.Motion_Simulated:
+                        var simMotionCtrl = new SimulatedMotion(count, simulatedConfig);
+
+                        foreach (var data in simMotionCtrl.GetMotionDataDictionary())
+                        {
+                            AxisData[data.Key] = data.Value;
+                        }
+                        break;
                         // 다른 컨트롤러 유형도 추가 가능
                 }
             }
@@ -125,8 +155,9 @@ namespace VSLibrary.Controller
 
         /// <summary>
         /// Updates all controller data: analog channels, digital I/O, and motion statuses/positions.
+        /// Called every cycle by the worker thread; public so it can be driven directly (e.g., benchmarks).
         /// </summary>
-        private void UpdateControllerData()
+        public void UpdateControllerData()
         {
             try
             {
@@ -0,0 +1,186 @@
+using System;
+using System.Collections.Generic;
+using System.Linq;
+
+namespace VSLibrary.Controller.DigitalIO
+{
+    /// <summary>
+    /// Headless digital I/O controller that keeps bit states in 32-bit module words.
+    /// Lets sequences, UI and benchmarks run without an Ajin/Comizoa board;
+    /// each driver call can be delayed via <see cref="SimulatedControllerConfig.LatencyMs"/>.
+    /// </summary>
+    public class SimulatedDIO : DIOBase
+    {
+        private const int BitsPerModule = 32;
+
+        /// <summary>
+        /// Dictionary storing digital I/O data objects keyed by wire name.
+        /// </summary>
+        private Dictionary<string, IDigitalIOData> _digitalIOData = new Dictionary<string, IDigitalIOData>();
+
+        private Dictionary<string, int> _iocount;
+
+        private readonly SimulatedControllerConfig _config;
+
+        /// <summary>
+        /// Simulated module words (index = ModuleIndex, bit = Offset).
+        /// </summary>
+        private readonly uint[] _inputWords;
+        private readonly uint[] _outputWords;
+
+        /// <summary>
+        /// Constructs the simulated digital I/O controller and creates its points.
+        /// </summary>
+        /// <param name="count">Dictionary containing channel counts (e.g., "DInput", "DOutput").</param>
+        /// <param name="config">Point counts and per-call latency.</param>
+        public SimulatedDIO(Dictionary<string, int> count, SimulatedControllerConfig config)
+        {
+            _iocount = count;
+            _config = config ?? new SimulatedControllerConfig();
+
+            _inputWords = new uint[(_config.DigitalInputCount + BitsPerModule - 1) / BitsPerModule];
+            _outputWords = new uint[(_config.DigitalOutputCount + BitsPerModule - 1) / BitsPerModule];
+
+            OpenDevice();
+        }
+
+        /// <summary>
+        /// Creates input (X) and output (Y) entries and updates _iocount.
+        /// </summary>
+        public void OpenDevice()
+        {
+            AddPoints(IOType.InPut, _config.DigitalInputCount, "X", "DInput", "SIM_DI32");
+            AddPoints(IOType.OUTPut, _config.DigitalOutputCount, "Y", "DOutput", "SIM_DO32");
+        }
+
+        private void AddPoints(IOType ioType, int pointCount, string prefix, string countKey, string moduleName)
+        {
+            for (int i = 0; i < pointCount; i++)
+            {
+                DIOData data = new DIOData
+                {
+                    Controller = this,
+                    ControllerType = ControllerType.DIO_Simulated,
+                    IOType = ioType,
+                    WireName = $"{prefix}{i + _iocount[countKey]:X3}",  // e.g.: X000, Y000, ...
+                    StrdataName = string.Empty,
+                    ModuleName = moduleName,
+                    ModuleIndex = i / BitsPerModule,
+                    Value = false,
+                    PollingState = false,
+                    StateReversal = false,
+                    Offset = i % BitsPerModule,
+                    Edge = false,
+                    DetectionTime = 0
+                };
+                _digitalIOData.Add(data.WireName, data);
+            }
+            _iocount[countKey] += pointCount;
+        }
+
+        private uint[] Words(IOType ioType) => ioType == IOType.InPut ? _inputWords : _outputWords;
+
+        /// <summary>
+        /// Returns the dictionary of digital I/O data objects.
+        /// </summary>
+        public override Dictionary<string, IDigitalIOData> GetDigitalIODataDictionary()
+        {
+            return _digitalIOData.ToDictionary(kvp => kvp.Key, kvp => kvp.Value);
+        }
+
+        /// <summary>
+        /// Forces the state of a simulated input point (e.g., sensor on/off).
+        /// </summary>
+        /// <param name="index">Zero-based input index on this controller.</param>
+        /// <param name="value">State to present on the input.</param>
+        public void SetInput(int index, bool value)
+        {
+            uint mask = 1u << (index % BitsPerModule);
+            if (value)
+                _inputWords[index / BitsPerModule] |= mask;
+            else
+                _inputWords[index / BitsPerModule] &= ~mask;
+        }
+
+        /// <summary>
+        /// Reads the state of a single bit for the specified I/O data.
+        /// </summary>
+        public override bool ReadBit(IDigitalIOData dioData)
+        {
+            _config.WaitLatency();
+
+            uint word = Words(dioData.IOType)[dioData.ModuleIndex];
+            dioData.Value = (word & (1u << dioData.Offset)) != 0;
+            return dioData.Value;
+        }
+
+        /// <summary>
+        /// Writes a bit to the specified output I/O data and returns its new state.
+        /// </summary>
+        public override bool WriteBit(IDigitalIOData dioData, bool value)
+        {
+            if (dioData.IOType != IOType.OUTPut)
+                throw new InvalidOperationException("Cannot write to an input channel.");
+
+            _config.WaitLatency();
+
+            uint mask = 1u << dioData.Offset;
+            if (value)
+                _outputWords[dioData.ModuleIndex] |= mask;
+            else
+                _outputWords[dioData.ModuleIndex] &= ~mask;
+
+            dioData.Value = value;
+            return value;
+        }
+
+        /// <summary>
+        /// Reads a 32-bit module word and updates each bit's state.
+        /// </summary>
+        /// <param name="dioDataDict">Dictionary of digital I/O data.</param>
+        /// <param name="key">Key identifying the module to read.</param>
+        public override void ReadDword(Dictionary<string, IDigitalIOData> dioDataDict, string key)
+        {
+            _config.WaitLatency();
+
+            var target = dioDataDict[key];
+            int idx = target.ModuleIndex;
+            uint data = Words(target.IOType)[idx];
+
+            var sameModule = dioDataDict.Values.Where(x => x.ModuleIndex == idx && x.IOType == target.IOType);
+            foreach (var item in sameModule)
+            {
+                item.Value = (data & (1u << item.Offset)) != 0;
+            }
+        }
+
+        /// <summary>
+        /// Writes a 32-bit value to the specified output module and updates its bit states.
+        /// </summary>
+        public override void WriteDword(Dictionary<string, IDigitalIOData> dioDataDict, string key, uint value)
+        {
+            var target = dioDataDict[key];
+            if (target.IOType != IOType.OUTPut)
+                throw new InvalidOperationException("Cannot write to an input channel.");
+
+            _outputWords[target.ModuleIndex] = value;
+            ReadDword(dioDataDict, key);
+        }
+
+        /// <summary>
+        /// Updates all I/O states from the simulated module words.
+        /// Costs one latency period per module, like a DWORD board read.
+        /// </summary>
+        public override void UpdateAllIOStates()
+        {
+            foreach (var data in _digitalIOData.Values)
+            {
+                if (data.Offset == 0)
+                    _config.WaitLatency();
+
+                uint word = Words(data.IOType)[data.ModuleIndex];
+                data.Value = (word & (1u << data.Offset)) != 0;
+            }
+        }
+    }
+}
@@ -0,0 +1,430 @@
+using System;
+using System.Collections.Generic;
+using System.Diagnostics;
+using System.Linq;
+using System.Threading.Tasks;
+
+namespace VSLibrary.Controller.Motion
+{
+    /// <summary>
+    /// Headless multi-axis motion controller.
+    /// Axes follow a constant-velocity profile computed from elapsed time, so positions advance
+    /// realistically without a board; each driver call can be delayed via <see cref="SimulatedControllerConfig.LatencyMs"/>.
+    /// </summary>
+    public class SimulatedMotion : MotionBase
+    {
+        private const int UniversalIOCount = 6;
+        private const double DefaultHomeVelocity = 10.0;
+
+        /// <summary>
+        /// Simulated drive state for one axis.
+        /// </summary>
+        private class AxisState
+        {
+            public double StartPosition;
+            public double TargetPosition;
+            public double Velocity;
+            public long StartTimestamp;
+            public bool Servo;
+            public bool Homed;
+            public bool Alarm;
+            /// <summary>Bumped by every command and halt; a task only acts while its generation is current.</summary>
+            public int Generation;
+            public readonly bool[] Inputs = new bool[UniversalIOCount];
+            public readonly bool[] Outputs = new bool[UniversalIOCount];
+        }
+
+        /// <summary>
+        /// Dictionary storing axis data objects keyed by axis number.
+        /// </summary>
+        private Dictionary<int, IAxisData> _axisData = new Dictionary<int, IAxisData>();
+
+        private readonly Dictionary<int, AxisState> _states = new Dictionary<int, AxisState>();
+
+        private Dictionary<string, int> _iocount;
+
+        private readonly SimulatedControllerConfig _config;
+
+        /// <summary>
+        /// Constructs the simulated motion controller and creates its axes.
+        /// </summary>
+        /// <param name="count">Dictionary containing channel counts.</param>
+        /// <param name="config">Axis count and per-call latency.</param>
+        public SimulatedMotion(Dictionary<string, int> count, SimulatedControllerConfig config)
+        {
+            _iocount = count;
+            _config = config ?? new SimulatedControllerConfig();
+
+            OpenDevice();
+        }
+
+        /// <summary>
+        /// Creates axis data entries for every simulated axis.
+        /// </summary>
+        public void OpenDevice()
+        {
+            for (short axis = 0; axis < _config.AxisCount; axis++)
+            {
+                AxtAxisData data = new AxtAxisData
+                {
+                    Controller = this,
+                    ControllerType = ControllerType.Motion_Simulated,
+                    AxisNo = axis,
+                    AxisName = $"SIM_AXIS{axis}",
+                    ModuleName = "SIM_MOTION",
+                    MinSpeed = 1,
+                    MaxSpeed = 1000
+                };
+                _axisData.Add(axis, data);
+                _states.Add(axis, new AxisState { StartTimestamp = Stopwatch.GetTimestamp() });
+            }
+        }
+
+        /// <summary>
+        /// Verifies that the axis exists.
+        /// </summary>
+        private bool CheckDic(int axis)
+        {
+            if (!_states.ContainsKey(axis))
+            {
+                Console.WriteLine($"[Error] No simulated axis {axis}.");
+                return false;
+            }
+            return true;
+        }
+
+        /// <summary>
+        /// Verifies that the axis exists and can be commanded (servo on, no alarm).
+        /// </summary>
+        private bool CheckReady(int axis)
+        {
+            if (!CheckDic(axis)) return false;
+
+            var s = _states[axis];
+            if (!s.Servo || s.Alarm)
+            {
+                Console.WriteLine($"[Error] Simulated axis {axis} is not ready (Servo={s.Servo}, Alarm={s.Alarm}); move ignored.");
+                return false;
+            }
+            return true;
+        }
+
+        /// <summary>
+        /// Position along the current move at the given time.
+        /// </summary>
+        private static double PositionAt(AxisState s, long timestamp)
+        {
+            double distance = s.TargetPosition - s.StartPosition;
+            if (s.Velocity <= 0 || distance == 0)
+                return s.TargetPosition;
+
+            double elapsed = (double)(timestamp - s.StartTimestamp) / Stopwatch.Frequency;
+            double travelled = s.Velocity * elapsed;
+            if (travelled >= Math.Abs(distance))
+                return s.TargetPosition;
+
+            return s.StartPosition + Math.Sign(distance) * travelled;
+        }
+
+        /// <summary>
+        /// Starts a new command on the axis, superseding any running Repeat/HomeMove.
+        /// </summary>
+        private static int BeginCommand(AxisState s)
+        {
+            lock (s)
+            {
+                return ++s.Generation;
+            }
+        }
+
+        /// <summary>
+        /// Starts a segment of the command identified by <paramref name="generation"/>.
+        /// Returns false without moving if a newer command or a halt has superseded it.
+        /// </summary>
+        private bool StartMove(int axis, int generation, double target, double velocity, bool relative = false)
+        {
+            var s = _states[axis];
+            lock (s)
+            {
+                if (s.Generation != generation)
+                    return false;
+
+                long now = Stopwatch.GetTimestamp();
+                s.StartPosition = PositionAt(s, now);
+                s.TargetPosition = relative ? s.StartPosition + target : target;
+                s.Velocity = velocity;
+                s.StartTimestamp = now;
+            }
+            return true;
+        }
+
+        /// <summary>
+        /// Freezes the profile at the current position, as a drive does on stop, servo-off or alarm.
+        /// </summary>
+        private static void Halt(AxisState s)
+        {
+            lock (s)
+            {
+                s.Generation++;
+                long now = Stopwatch.GetTimestamp();
+                s.StartPosition = s.TargetPosition = PositionAt(s, now);
+                s.StartTimestamp = now;
+            }
+        }
+
+        /// <summary>
+        /// Applies a servo state; servo-off halts the axis and drops the home flag.
+        /// </summary>
+        private static void ApplyServo(AxisState s, bool enabled)
+        {
+            s.Servo = enabled;
+            s.Outputs[0] = enabled;
+            if (!enabled)
+            {
+                s.Homed = false;
+                Halt(s);
+            }
+        }
+
+        private async Task WaitMoveDoneAsync(int axis)
+        {
+            while (IsMoving(axis))
+                await Task.Delay(1);
+        }
+
+        public override Dictionary<int, IAxisData> GetMotionDataDictionary()
+        {
+            return _axisData.ToDictionary(kvp => kvp.Key, kvp => kvp.Value);
+        }
+
+        /// <summary>
+        /// Forces the state of a simulated universal input.
+        /// </summary>
+        public void SetInput(int axis, int port, bool state)
+        {
+            _states[axis].Inputs[port] = state;
+        }
+
+        /// <summary>
+        /// Raises or clears the simulated drive alarm. Raising it halts the axis.
+        /// </summary>
+        public void SetAlarm(int axis, bool alarm)
+        {
+            var s = _states[axis];
+            s.Alarm = alarm;
+            if (alarm)
+                Halt(s);
+        }
+
+        /// <summary>
+        /// Moves the specified axis by a relative distance.
+        /// </summary>
+        public override void MoveToPosition(int axis, double position, double velocity, double acceleration)
+        {
+            if (!CheckReady(axis)) return;
+
+            _config.WaitLatency();
+            var data = _axisData[axis];
+            data.CurrentPosition = position;
+            data.CurrentVelocity = velocity;
+            data.CurrentAcceleration = acceleration;
+
+            StartMove(axis, BeginCommand(_states[axis]), position, velocity, relative: true);
+        }
+
+        /// <summary>
+        /// Moves the specified axis to an absolute position.
+        /// </summary>
+        public override void MoveToPoint(int axis, double position, double velocity, double acceleration)
+        {
+            if (!CheckReady(axis)) return;
+
+            _config.WaitLatency();
+            var data = _axisData[axis];
+            data.CurrentPosition = position;
+            data.CurrentVelocity = velocity;
+            data.CurrentAcceleration = acceleration;
+
+            StartMove(axis, BeginCommand(_states[axis]), position, velocity);
+        }
+
+        /// <summary>
+        /// Moves through the given absolute positions repeatCount times, asynchronously.
+        /// </summary>
+        public override void Repeat(int axis, double[] position, double velocity, double acceleration, int repeatCount)
+        {
+            if (!CheckReady(axis)) return;
+
+            int generation = BeginCommand(_states[axis]);
+
+            _ = Task.Run(async () =>
+            {
+                for (int repeat = 0; repeat < repeatCount; repeat++)
+                {
+                    foreach (double target in position)
+                    {
+                        if (!StartMove(axis, generation, target, velocity)) return;
+                        await WaitMoveDoneAsync(axis);
+                    }
+                }
+            });
+        }
+
+        public override bool StopMotion(int axis)
+        {
+            if (!CheckDic(axis)) return false;
+
+            _config.WaitLatency();
+            Halt(_states[axis]);
+            return true;
+        }
+
+        public override double GetPosition(int axis)
+        {
+            if (!CheckDic(axis)) return 0;
+
+            _config.WaitLatency();
+            var s = _states[axis];
+            lock (s)
+            {
+                return PositionAt(s, Stopwatch.GetTimestamp());
+            }
+        }
+
+        public override double GetCmdPosition(int axis)
+        {
+            if (!CheckDic(axis)) return 0;
+
+            _config.WaitLatency();
+            return _states[axis].TargetPosition;
+        }
+
+        public override double GetVelocity(int axis)
+        {
+            return IsMoving(axis) ? _states[axis].Velocity : 0;
+        }
+
+        public override void SetServoOnOff(int axis, bool enabled)
+        {
+            if (!CheckDic(axis)) return;
+
+            _config.WaitLatency();
+            ApplyServo(_states[axis], enabled);
+        }
+
+        public override bool SetParameter(IAxisData motionData) => CheckDic(motionData.AxisNo);
+
+        public override bool GetParameter(IAxisData motionData) => CheckDic(motionData.AxisNo);
+
+        public override bool IsServo(int axis) => CheckDic(axis) && _states[axis].Servo;
+
+        public override bool IsHomed(int axis) => CheckDic(axis) && _states[axis].Homed;
+
+        public override Task ClearAlarm(int axis)
+        {
+            if (CheckDic(axis))
+                _states[axis].Alarm = false;
+            return Task.CompletedTask;
+        }
+
+        /// <summary>
+        /// Drives the axis to zero at the first configured home velocity and marks it homed.
+        /// </summary>
+        public override async Task HomeMove(int axis, Motion_HomeConfig initset)
+        {
+            if (!CheckReady(axis)) return;
+
+            var s = _states[axis];
+            s.Homed = false;
+            int generation = BeginCommand(s);
+
+            double velocity = initset.HomeVelocities?.FirstOrDefault() ?? 0;
+            StartMove(axis, generation, 0, velocity > 0 ? velocity : DefaultHomeVelocity);
+            await WaitMoveDoneAsync(axis);
+
+            lock (s)
+            {
+                s.Homed = s.Servo && s.Generation == generation;
+            }
+        }
+
+        public override bool IsAlarm(int axis) => CheckDic(axis) && _states[axis].Alarm;
+
+        public override bool IsMoving(int axis)
+        {
+            if (!CheckDic(axis)) return false;
+
+            var s = _states[axis];
+            lock (s)
+            {
+                return PositionAt(s, Stopwatch.GetTimestamp()) != s.TargetPosition;
+            }
+        }
+
+        public override bool IsPositiveLimit(int axis) => false;
+
+        public override bool IsNegativeLimit(int axis) => false;
+
+        /// <summary>
+        /// Updates servo/home/alarm/in-position states for each axis.
+        /// Costs one latency period per axis, like a status register read.
+        /// </summary>
+        public override void UpdateAllIOStatus()
+        {
+            foreach (AxtAxisData motionData in _axisData.Values)
+            {
+                _config.WaitLatency();
+                var s = _states[motionData.AxisNo];
+
+                motionData.IOStatus = new Motion_IOStatus(ToBits(s.Inputs), ToBits(s.Outputs));
+                motionData.ServoEnabled = motionData.ServoEnabledReversal ? !s.Servo : s.Servo;
+                motionData.HomeState = s.Homed;
+                motionData.Alarm = s.Alarm;
+                motionData.PositiveLimit = false;
+                motionData.NegativeLimit = false;
+                motionData.InPosition = !IsMoving(motionData.AxisNo);
+            }
+        }
+
+        /// <summary>
+        /// Updates all axis positions and velocities.
+        /// </summary>
+        public override void UpdateAllPosition()
+        {
+            foreach (AxtAxisData motionData in _axisData.Values)
+            {
+                motionData.Position = GetPosition(motionData.AxisNo);
+                motionData.Velocity = GetVelocity(motionData.AxisNo);
+            }
+        }
+
+        private static uint ToBits(bool[] states)
+        {
+            uint bits = 0;
+            for (int i = 0; i < states.Length; i++)
+            {
+                if (states[i])
+                    bits |= 1u << i;
+            }
+            return bits;
+        }
+
+        // ==================== 유니버셜 I/O 기능 ====================
+
+        public override bool SetOutput(int axis, int port, bool state)
+        {
+            if (!CheckDic(axis)) return false;
+
+            _config.WaitLatency();
+            if (port == 0)
+                ApplyServo(_states[axis], state);
+            else
+                _states[axis].Outputs[port] = state;
+            return true;
+        }
+
+        public override bool GetInput(int axis, int port) => CheckDic(axis) && _states[axis].Inputs[port];
+
+        public override bool GetOutput(int axis, int port) => CheckDic(axis) && _states[axis].Outputs[port];
+    }
+}